@@ -4,6 +4,9 @@
 
 #define LOCTEXT_NAMESPACE "FCharacterSystemModule"
 
+DEFINE_LOG_CATEGORY(LogCharacterSystem);
+LLM_DEFINE_TAG(CharacterSystem);
+
 void FCharacterSystemModule::StartupModule() {
   // This code will execute after your module is loaded into memory
 }
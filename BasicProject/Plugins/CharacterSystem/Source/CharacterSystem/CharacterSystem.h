@@ -2,8 +2,15 @@
 
 #pragma once
 
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
 #include "Modules/ModuleManager.h"
 
+CHARACTERSYSTEM_API DECLARE_LOG_CATEGORY_EXTERN(LogCharacterSystem, Log, All);
+
+// LLM tag for CharacterSystem allocations (-llm, stat LLMFULL)
+LLM_DECLARE_TAG_API(CharacterSystem, CHARACTERSYSTEM_API);
+
 class FCharacterSystemModule : public IModuleInterface {
 public:
   /** IModuleInterface implementation */
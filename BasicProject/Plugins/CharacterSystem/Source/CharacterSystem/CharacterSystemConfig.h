@@ -9,9 +9,25 @@
 class UInputMappingContext;
 class UInputAction;
 
+/**
+ * How the aim point under the mouse cursor is found.
+ */
+UENUM(BlueprintType)
+enum class ECursorAimMode : uint8 {
+  /** Intersect the cursor ray with the character's ground plane (no trace) */
+  GroundPlane,
+  /** Ground plane, refined by an async trace issued only when the cursor
+   * ray changes */
+  GroundPlaneWithTraceRefinement,
+  /** Synchronous visibility trace under the cursor every frame */
+  PhysicsTrace,
+};
+
 /**
  * Configuration Data Asset for Character System.
  * Holds references to Input Actions and Mapping Contexts.
+ * Input assets belong to the "Input" bundle and are loaded asynchronously with
+ * the config by UCharacterSystemSubsystem.
  */
 UCLASS(BlueprintType)
 class CHARACTERSYSTEM_API UCharacterSystemConfig : public UPrimaryDataAsset {
@@ -23,15 +39,18 @@ public:
   // ============================================
 
   /** Default Input Mapping Context for top-down movement */
-  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input",
+            meta = (AssetBundles = "Input"))
   TSoftObjectPtr<UInputMappingContext> DefaultMappingContext;
 
   /** Move Input Action */
-  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input",
+            meta = (AssetBundles = "Input"))
   TSoftObjectPtr<UInputAction> MoveAction;
 
   /** Interact Input Action */
-  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input",
+            meta = (AssetBundles = "Input"))
   TSoftObjectPtr<UInputAction> InteractAction;
 
   // ============================================
@@ -55,6 +74,30 @@ public:
   UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement")
   float RotationInterpSpeed = 15.f;
 
+  /** How the aim point under the mouse cursor is found */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement")
+  ECursorAimMode CursorAimMode = ECursorAimMode::GroundPlane;
+
+  /** Maximum ground speed of UTopDownMovementComponent agents (cm/s) */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement",
+            meta = (ClampMin = "0.0"))
+  float MaxWalkSpeed = 600.f;
+
+  /** Acceleration of UTopDownMovementComponent agents (cm/s^2) */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement",
+            meta = (ClampMin = "0.0"))
+  float MaxAcceleration = 2048.f;
+
+  /** Deceleration without input of UTopDownMovementComponent agents (cm/s^2) */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement",
+            meta = (ClampMin = "0.0"))
+  float BrakingDeceleration = 2048.f;
+
+  /** Yaw rate of agents that orient to their movement (degrees/s) */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement",
+            meta = (ClampMin = "0.0"))
+  float OrientRotationRate = 540.f;
+
 public:
   // ============================================
   // Asset Info
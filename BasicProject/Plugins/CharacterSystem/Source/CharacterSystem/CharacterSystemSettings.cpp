@@ -11,7 +11,7 @@ UCharacterSystemSettings *UCharacterSystemSettings::Get() {
 
 UCharacterSystemConfig *UCharacterSystemSettings::GetConfig() const {
   if (CharacterSystemConfig.IsValid()) {
-    return Cast<UCharacterSystemConfig>(CharacterSystemConfig.TryLoad());
+    return Cast<UCharacterSystemConfig>(CharacterSystemConfig.ResolveObject());
   }
   return nullptr;
 }
@@ -38,7 +38,8 @@ public:
   /** Get the singleton settings instance */
   static UCharacterSystemSettings *Get();
 
-  /** Get the Character System Config Data Asset (loads if needed) */
+  /** Get the Character System Config Data Asset if it is already loaded.
+   * Never loads; UCharacterSystemSubsystem loads it asynchronously at startup */
   UFUNCTION(BlueprintCallable, Category = "Character System")
   UCharacterSystemConfig *GetConfig() const;
 
@@ -0,0 +1,111 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CharacterSystemSubsystem.h"
+#include "CharacterSystem.h"
+#include "CharacterSystemConfig.h"
+#include "CharacterSystemSettings.h"
+#include "Engine/AssetManager.h"
+
+const FName UCharacterSystemSubsystem::InputBundle(TEXT("Input"));
+
+void UCharacterSystemSubsystem::Initialize(
+    FSubsystemCollectionBase &Collection) {
+  LLM_SCOPE_BYTAG(CharacterSystem);
+  Super::Initialize(Collection);
+
+  const FSoftObjectPath &ConfigPath =
+      UCharacterSystemSettings::Get()->CharacterSystemConfig;
+  if (!ConfigPath.IsValid()) {
+    HandleConfigLoaded();
+    return;
+  }
+
+  // Preferred path: the config is a primary asset scanned by the AssetManager
+  // (DefaultGame.ini), so the config and its input bundle load in one request
+  UAssetManager &AssetManager = UAssetManager::Get();
+  const FPrimaryAssetId ConfigId(TEXT("CharacterSystemConfig"),
+                                 FName(ConfigPath.GetAssetName()));
+  ConfigHandle = AssetManager.LoadPrimaryAsset(
+      ConfigId, {InputBundle},
+      FStreamableDelegate::CreateUObject(
+          this, &UCharacterSystemSubsystem::HandleConfigLoaded));
+  if (ConfigHandle || bConfigLoaded) {
+    return;
+  }
+
+  // Not registered as a primary asset: load the object, then its inputs
+  ConfigHandle = AssetManager.GetStreamableManager().RequestAsyncLoad(
+      ConfigPath, FStreamableDelegate::CreateWeakLambda(this, [this,
+                                                               ConfigPath]() {
+        InputHandle = LoadConfigInputs(
+            Cast<UCharacterSystemConfig>(ConfigPath.ResolveObject()),
+            FStreamableDelegate::CreateUObject(
+                this, &UCharacterSystemSubsystem::HandleConfigLoaded));
+      }));
+  if (!ConfigHandle) {
+    HandleConfigLoaded();
+  }
+}
+
+void UCharacterSystemSubsystem::Deinitialize() {
+  for (TSharedPtr<FStreamableHandle> *Handle : {&ConfigHandle, &InputHandle}) {
+    if (*Handle) {
+      (*Handle)->CancelHandle();
+      Handle->Reset();
+    }
+  }
+  PendingDelegates.Empty();
+  Config = nullptr;
+  bConfigLoaded = false;
+  Super::Deinitialize();
+}
+
+void UCharacterSystemSubsystem::CallOrRegister_OnConfigLoaded(
+    FSimpleDelegate &&Delegate) {
+  if (bConfigLoaded) {
+    Delegate.ExecuteIfBound();
+  } else {
+    PendingDelegates.Add(MoveTemp(Delegate));
+  }
+}
+
+TSharedPtr<FStreamableHandle>
+UCharacterSystemSubsystem::LoadConfigInputs(UCharacterSystemConfig *InConfig,
+                                            FStreamableDelegate &&Delegate) {
+  TArray<FSoftObjectPath> InputPaths;
+  if (InConfig) {
+    for (const FSoftObjectPath &Path :
+         {InConfig->DefaultMappingContext.ToSoftObjectPath(),
+          InConfig->MoveAction.ToSoftObjectPath(),
+          InConfig->InteractAction.ToSoftObjectPath()}) {
+      if (Path.IsValid()) {
+        InputPaths.Add(Path);
+      }
+    }
+  }
+
+  if (InputPaths.IsEmpty()) {
+    Delegate.ExecuteIfBound();
+    return nullptr;
+  }
+  return UAssetManager::Get().GetStreamableManager().RequestAsyncLoad(
+      MoveTemp(InputPaths), MoveTemp(Delegate));
+}
+
+void UCharacterSystemSubsystem::HandleConfigLoaded() {
+  if (bConfigLoaded) {
+    return;
+  }
+
+  const FSoftObjectPath &ConfigPath =
+      UCharacterSystemSettings::Get()->CharacterSystemConfig;
+  Config = Cast<UCharacterSystemConfig>(ConfigPath.ResolveObject());
+  bConfigLoaded = true;
+
+  // Waiters may register more delegates; those run immediately
+  TArray<FSimpleDelegate> Delegates = MoveTemp(PendingDelegates);
+  PendingDelegates.Reset();
+  for (FSimpleDelegate &Delegate : Delegates) {
+    Delegate.ExecuteIfBound();
+  }
+}
@@ -0,0 +1,75 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "CharacterSystemSubsystem.generated.h"
+
+class UCharacterSystemConfig;
+
+/**
+ * Loads the project's CharacterSystemConfig and its input assets once,
+ * asynchronously through the AssetManager, when the game instance starts.
+ * Characters share the cached config and wait on the load instead of
+ * loading synchronously on possession or respawn.
+ */
+UCLASS()
+class CHARACTERSYSTEM_API UCharacterSystemSubsystem
+    : public UGameInstanceSubsystem {
+  GENERATED_BODY()
+
+public:
+  /** Asset bundle holding the input assets of a config */
+  static const FName InputBundle;
+
+  // ============================================
+  // USubsystem Interface
+  // ============================================
+
+  virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+  virtual void Deinitialize() override;
+
+  // ============================================
+  // Accessors
+  // ============================================
+
+  /** Get the project config (null until its async load has finished) */
+  UFUNCTION(BlueprintCallable, Category = "Character System")
+  UCharacterSystemConfig *GetConfig() const { return Config; }
+
+  /** Check if the project config and its input assets are loaded */
+  UFUNCTION(BlueprintCallable, Category = "Character System")
+  bool IsConfigLoaded() const { return bConfigLoaded; }
+
+  /** Call Delegate now if the config is loaded, otherwise once it is */
+  void CallOrRegister_OnConfigLoaded(FSimpleDelegate &&Delegate);
+
+  /**
+   * Async-load the input assets of another config (e.g. a per-character
+   * override). Delegate runs when they are ready, immediately if already
+   * loaded. Keep the returned handle alive while the assets are needed.
+   */
+  TSharedPtr<FStreamableHandle> LoadConfigInputs(UCharacterSystemConfig *InConfig,
+                                                 FStreamableDelegate &&Delegate);
+
+private:
+  /** Project config finished loading (with or without its input bundle) */
+  void HandleConfigLoaded();
+
+  /** Loaded project config */
+  UPROPERTY(Transient)
+  TObjectPtr<UCharacterSystemConfig> Config;
+
+  /** Keeps the config and its input bundle loaded */
+  TSharedPtr<FStreamableHandle> ConfigHandle;
+
+  /** Input assets, when the config is not a scanned primary asset */
+  TSharedPtr<FStreamableHandle> InputHandle;
+
+  /** Delegates waiting for the config */
+  TArray<FSimpleDelegate> PendingDelegates;
+
+  bool bConfigLoaded = false;
+};
@@ -0,0 +1,68 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TopDownBotController.h"
+#include "GameFramework/Pawn.h"
+#include "InteractionDetectorComponent.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+CSV_DECLARE_CATEGORY_EXTERN(LoadTest);
+
+ATopDownBotController::ATopDownBotController() {
+  PrimaryActorTick.bCanEverTick = true;
+  bWantsPlayerState = false;
+}
+
+void ATopDownBotController::InitializeBot(int32 Seed,
+                                          const FVector &InHomeLocation,
+                                          float InWanderRadius) {
+  Random.Initialize(Seed);
+  HomeLocation = InHomeLocation;
+  WanderRadius = InWanderRadius;
+
+  // Stagger bots so their presses do not land on the same frame
+  TimeUntilInteract = Random.FRandRange(0.f, InteractInterval);
+  ChooseDirection();
+}
+
+void ATopDownBotController::OnPossess(APawn *InPawn) {
+  Super::OnPossess(InPawn);
+  Detector = InPawn ? InPawn->FindComponentByClass<UInteractionDetectorComponent>()
+                    : nullptr;
+}
+
+void ATopDownBotController::Tick(float DeltaSeconds) {
+  Super::Tick(DeltaSeconds);
+  CSV_SCOPED_TIMING_STAT(LoadTest, BotInput);
+
+  APawn *BotPawn = GetPawn();
+  if (!BotPawn) {
+    return;
+  }
+
+  // Wander, turning back home when leaving the area
+  const FVector FromHome = BotPawn->GetActorLocation() - HomeLocation;
+  TimeUntilDirectionChange -= DeltaSeconds;
+  if (TimeUntilDirectionChange <= 0.f) {
+    ChooseDirection();
+  } else if (FromHome.SizeSquared2D() > FMath::Square(WanderRadius) &&
+             FVector::DotProduct(FromHome, MoveDirection) > 0.f) {
+    MoveDirection = (-FromHome).GetSafeNormal2D();
+  }
+  BotPawn->AddMovementInput(MoveDirection, 1.f);
+
+  // Same entry point as the player's Interact input
+  TimeUntilInteract -= DeltaSeconds;
+  if (TimeUntilInteract <= 0.f) {
+    TimeUntilInteract = InteractInterval * Random.FRandRange(0.5f, 1.5f);
+    if (Detector) {
+      Detector->TryInteract();
+    }
+  }
+}
+
+void ATopDownBotController::ChooseDirection() {
+  const float Angle = Random.FRandRange(0.f, UE_TWO_PI);
+  MoveDirection = FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.f);
+  TimeUntilDirectionChange =
+      DirectionChangeInterval * Random.FRandRange(0.5f, 1.5f);
+}
@@ -0,0 +1,65 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Controller.h"
+#include "TopDownBotController.generated.h"
+
+class UInteractionDetectorComponent;
+
+/**
+ * Scripted controller for load-test bots.
+ * Wanders in random directions around a home location and presses Interact
+ * periodically, feeding the same movement and interaction paths as a player.
+ * Behaviour is driven by a seeded random stream so runs are repeatable.
+ */
+UCLASS()
+class CHARACTERSYSTEM_API ATopDownBotController : public AController {
+  GENERATED_BODY()
+
+public:
+  ATopDownBotController();
+
+  virtual void Tick(float DeltaSeconds) override;
+
+  /** Seed the behaviour and set the area the bot wanders in */
+  void InitializeBot(int32 Seed, const FVector &InHomeLocation,
+                     float InWanderRadius);
+
+protected:
+  virtual void OnPossess(APawn *InPawn) override;
+
+  // ============================================
+  // Behaviour
+  // ============================================
+
+  /** Average time between direction changes in seconds */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bot",
+            meta = (ClampMin = "0.1"))
+  float DirectionChangeInterval = 2.f;
+
+  /** Average time between interaction presses in seconds */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bot",
+            meta = (ClampMin = "0.1"))
+  float InteractInterval = 1.5f;
+
+  /** Bots turn back toward home beyond this distance */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bot",
+            meta = (ClampMin = "100.0"))
+  float WanderRadius = 2000.f;
+
+private:
+  /** Pick a new random wander direction */
+  void ChooseDirection();
+
+  /** Detector of the possessed pawn */
+  UPROPERTY(Transient)
+  TObjectPtr<UInteractionDetectorComponent> Detector;
+
+  FRandomStream Random;
+  FVector HomeLocation = FVector::ZeroVector;
+  FVector MoveDirection = FVector::ZeroVector;
+  float TimeUntilDirectionChange = 0.f;
+  float TimeUntilInteract = 0.f;
+};
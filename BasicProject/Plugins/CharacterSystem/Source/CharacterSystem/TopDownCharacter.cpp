@@ -2,11 +2,15 @@
 
 #include "TopDownCharacter.h"
 #include "Camera/CameraComponent.h"
+#include "CharacterSystem.h"
 #include "CharacterSystemConfig.h"
 #include "CharacterSystemSettings.h"
+#include "CharacterSystemSubsystem.h"
 #include "Components/CapsuleComponent.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
+#include "Engine/GameInstance.h"
+#include "Engine/StreamableManager.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/SpringArmComponent.h"
@@ -44,35 +48,67 @@ ATopDownCharacter::ATopDownCharacter() {
 }
 
 void ATopDownCharacter::BeginPlay() {
+  LLM_SCOPE_BYTAG(CharacterSystem);
   Super::BeginPlay();
 
-  // Load configuration from Data Asset
-  LoadConfiguration();
+  // Config assets are preloaded at startup; respawns find them ready
+  RequestConfiguration();
+}
 
-  // Apply camera settings
-  ApplyCameraSettings();
+void ATopDownCharacter::NotifyControllerChanged() {
+  Super::NotifyControllerChanged();
 
-  // Add Input Mapping Context from config
-  if (APlayerController *PlayerController =
-          Cast<APlayerController>(Controller)) {
-    if (UEnhancedInputLocalPlayerSubsystem *Subsystem =
-            ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(
-                PlayerController->GetLocalPlayer())) {
-      if (UCharacterSystemConfig *Config = GetConfig()) {
-        if (UInputMappingContext *IMC =
-                Config->DefaultMappingContext.LoadSynchronous()) {
-          Subsystem->AddMappingContext(IMC, 0);
-        }
-      }
-    }
+  // Possession after BeginPlay (respawn) still needs the mapping context
+  if (bConfigurationReady) {
+    AddInputMappingContext();
+  }
+}
+
+void ATopDownCharacter::RequestConfiguration() {
+  const UGameInstance *GameInstance = GetGameInstance();
+  UCharacterSystemSubsystem *Subsystem =
+      GameInstance ? GameInstance->GetSubsystem<UCharacterSystemSubsystem>()
+                   : nullptr;
+  if (!Subsystem) {
+    OnConfigurationLoaded();
+    return;
+  }
+
+  if (ConfigOverride) {
+    ConfigInputsHandle = Subsystem->LoadConfigInputs(
+        ConfigOverride, FStreamableDelegate::CreateUObject(
+                            this, &ATopDownCharacter::OnConfigurationLoaded));
+  } else {
+    Subsystem->CallOrRegister_OnConfigLoaded(FSimpleDelegate::CreateUObject(
+        this, &ATopDownCharacter::OnConfigurationLoaded));
+  }
+}
+
+void ATopDownCharacter::OnConfigurationLoaded() {
+  LLM_SCOPE_BYTAG(CharacterSystem);
+  if (bConfigurationReady) {
+    return;
   }
+  bConfigurationReady = true;
+
+  LoadConfiguration();
+  ApplyCameraSettings();
+  AddInputMappingContext();
+  BindInputActions();
 }
 
 void ATopDownCharacter::LoadConfiguration() {
-  // Priority: ConfigOverride > Project Settings
+  // Priority: ConfigOverride > Project Settings (both already loaded; this
+  // never touches the disk)
   if (ConfigOverride) {
     CachedConfig = ConfigOverride;
-  } else {
+  } else if (const UGameInstance *GameInstance = GetGameInstance()) {
+    if (const UCharacterSystemSubsystem *Subsystem =
+            GameInstance->GetSubsystem<UCharacterSystemSubsystem>()) {
+      CachedConfig = Subsystem->GetConfig();
+    }
+  }
+  if (!CachedConfig) {
     CachedConfig = UCharacterSystemSettings::Get()->GetConfig();
   }
 
@@ -81,6 +117,7 @@ void ATopDownCharacter::LoadConfiguration() {
     CameraArmLength = CachedConfig->CameraArmLength;
     CameraPitch = CachedConfig->CameraPitch;
     RotationInterpSpeed = CachedConfig->RotationInterpSpeed;
+    CursorAimMode = CachedConfig->CursorAimMode;
   }
 }
 
@@ -105,32 +142,55 @@ void ATopDownCharacter::SetupPlayerInputComponent(
     UInputComponent *PlayerInputComponent) {
   Super::SetupPlayerInputComponent(PlayerInputComponent);
 
-  // Load config if not already loaded (SetupPlayerInputComponent called before
-  // BeginPlay)
-  if (!CachedConfig) {
-    LoadConfiguration();
-  }
-
-  // Set up action bindings with Enhanced Input
-  if (UEnhancedInputComponent *EnhancedInputComponent =
-          Cast<UEnhancedInputComponent>(PlayerInputComponent)) {
-    if (UCharacterSystemConfig *Config = GetConfig()) {
-      // Move action
-      if (UInputAction *MoveAction = Config->MoveAction.LoadSynchronous()) {
-        EnhancedInputComponent->BindAction(MoveAction, ETriggerEvent::Triggered,
-                                           this, &ATopDownCharacter::Move);
-      }
-      // Interact action
-      if (UInputAction *InteractAction =
-              Config->InteractAction.LoadSynchronous()) {
-        EnhancedInputComponent->BindAction(InteractAction,
-                                           ETriggerEvent::Started, this,
-                                           &ATopDownCharacter::Interact);
-      }
+  // Called on possession, possibly before BeginPlay: bind now if the config
+  // is ready, otherwise OnConfigurationLoaded does it
+  PendingInputComponent = Cast<UEnhancedInputComponent>(PlayerInputComponent);
+  if (bConfigurationReady) {
+    BindInputActions();
+  }
+}
+
+void ATopDownCharacter::AddInputMappingContext() {
+  const APlayerController *PlayerController =
+      Cast<APlayerController>(Controller);
+  UEnhancedInputLocalPlayerSubsystem *Subsystem =
+      PlayerController
+          ? ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(
+                PlayerController->GetLocalPlayer())
+          : nullptr;
+  if (!Subsystem) {
+    return;
+  }
+
+  if (UCharacterSystemConfig *Config = GetConfig()) {
+    if (UInputMappingContext *IMC = Config->DefaultMappingContext.Get()) {
+      Subsystem->AddMappingContext(IMC, 0);
     }
   }
 }
 
+void ATopDownCharacter::BindInputActions() {
+  UEnhancedInputComponent *EnhancedInputComponent =
+      PendingInputComponent.Get();
+  UCharacterSystemConfig *Config = GetConfig();
+  if (!EnhancedInputComponent || !Config) {
+    return;
+  }
+  PendingInputComponent.Reset();
+
+  // Set up action bindings with Enhanced Input (assets are already loaded)
+  // Move action
+  if (UInputAction *MoveAction = Config->MoveAction.Get()) {
+    EnhancedInputComponent->BindAction(MoveAction, ETriggerEvent::Triggered,
+                                       this, &ATopDownCharacter::Move);
+  }
+  // Interact action
+  if (UInputAction *InteractAction = Config->InteractAction.Get()) {
+    EnhancedInputComponent->BindAction(InteractAction, ETriggerEvent::Started,
+                                       this, &ATopDownCharacter::Interact);
+  }
+}
+
 void ATopDownCharacter::Move(const FInputActionValue &Value) {
   FVector2D MovementVector = Value.Get<FVector2D>();
 
@@ -167,17 +227,88 @@ void ATopDownCharacter::UpdateCharacterRotation() {
   }
 }
 
-bool ATopDownCharacter::GetMouseWorldLocation(FVector &OutLocation) const {
+bool ATopDownCharacter::GetMouseWorldLocation(FVector &OutLocation) {
   APlayerController *PC = Cast<APlayerController>(GetController());
   if (!PC) {
     return false;
   }
 
-  FHitResult HitResult;
-  if (PC->GetHitResultUnderCursor(ECC_Visibility, false, HitResult)) {
-    OutLocation = HitResult.Location;
-    return true;
+  if (CursorAimMode == ECursorAimMode::PhysicsTrace) {
+    FHitResult HitResult;
+    if (PC->GetHitResultUnderCursor(ECC_Visibility, false, HitResult)) {
+      OutLocation = HitResult.Location;
+      return true;
+    }
+    return false;
+  }
+
+  FVector RayOrigin;
+  FVector RayDirection;
+  if (!PC->DeprojectMousePositionToWorld(RayOrigin, RayDirection)) {
+    return false;
   }
 
-  return false;
+  if (CursorAimMode == ECursorAimMode::GroundPlaneWithTraceRefinement) {
+    RequestCursorTrace(RayOrigin,
+                       RayOrigin + RayDirection * PC->HitResultTraceDistance);
+    if (bHasRefinedCursorLocation) {
+      OutLocation = RefinedCursorLocation;
+      return true;
+    }
+  }
+
+  // The character is constrained to a plane: intersect the cursor ray with
+  // the plane under its feet instead of tracing the world
+  if (RayDirection.Z > -KINDA_SMALL_NUMBER) {
+    return false;
+  }
+  const float GroundZ = GetActorLocation().Z -
+                        GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+  OutLocation = FMath::RayPlaneIntersection(
+      RayOrigin, RayDirection,
+      FPlane(FVector(0.f, 0.f, GroundZ), FVector::UpVector));
+  return true;
+}
+
+void ATopDownCharacter::RequestCursorTrace(const FVector &RayOrigin,
+                                           const FVector &RayEnd) {
+  if (!RayOrigin.Equals(LastCursorRayOrigin) ||
+      !RayEnd.Equals(LastCursorRayEnd)) {
+    LastCursorRayOrigin = RayOrigin;
+    LastCursorRayEnd = RayEnd;
+    bHasRefinedCursorLocation = false;
+    bCursorRayTraced = false;
+  }
+
+  // One trace in flight at most; a stale result is dropped on completion and
+  // the next update asks again
+  if (bCursorRayTraced ||
+      GetWorld()->IsTraceHandleValid(CursorTraceHandle, false)) {
+    return;
+  }
+
+  if (!CursorTraceDelegate.IsBound()) {
+    CursorTraceDelegate.BindUObject(this,
+                                    &ATopDownCharacter::OnCursorTraceCompleted);
+  }
+  FCollisionQueryParams Params(SCENE_QUERY_STAT(CursorAimTrace), false, this);
+  CursorTraceHandle = GetWorld()->AsyncLineTraceByChannel(
+      EAsyncTraceType::Single, RayOrigin, RayEnd, ECC_Visibility, Params,
+      FCollisionResponseParams::DefaultResponseParam, &CursorTraceDelegate);
+}
+
+void ATopDownCharacter::OnCursorTraceCompleted(const FTraceHandle &TraceHandle,
+                                               FTraceDatum &TraceDatum) {
+  CursorTraceHandle = FTraceHandle();
+  if (!TraceDatum.Start.Equals(LastCursorRayOrigin) ||
+      !TraceDatum.End.Equals(LastCursorRayEnd)) {
+    return;
+  }
+  bCursorRayTraced = true;
+
+  // Misses keep using the ground plane
+  if (TraceDatum.OutHits.Num() > 0 && TraceDatum.OutHits[0].bBlockingHit) {
+    RefinedCursorLocation = TraceDatum.OutHits[0].Location;
+    bHasRefinedCursorLocation = true;
+  }
 }
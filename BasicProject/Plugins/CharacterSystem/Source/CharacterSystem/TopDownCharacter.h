@@ -4,7 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "CharacterSystemConfig.h"
 #include "InputActionValue.h"
+#include "WorldCollision.h"
 #include "TopDownCharacter.generated.h"
 
 class USpringArmComponent;
@@ -12,12 +14,15 @@ class UCameraComponent;
 class UInputMappingContext;
 class UInputAction;
 class UCharacterSystemConfig;
+class UEnhancedInputComponent;
+struct FStreamableHandle;
 
 /**
  * Top-down character with fixed camera and mouse cursor rotation.
  * Designed for top-down games with WASD movement and mouse aiming.
  * Configuration is loaded from CharacterSystemConfig Data Asset via Project
- * Settings.
+ * Settings. Input is bound once the config's assets have loaded
+ * asynchronously (see UCharacterSystemSubsystem).
  */
 UCLASS()
 class CHARACTERSYSTEM_API ATopDownCharacter : public ACharacter {
@@ -28,6 +33,7 @@ public:
 
 protected:
   virtual void BeginPlay() override;
+  virtual void NotifyControllerChanged() override;
 
 public:
   virtual void Tick(float DeltaTime) override;
@@ -79,6 +85,10 @@ protected:
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Rotation")
   float RotationInterpSpeed = 15.f;
 
+  /** How the aim point under the cursor is found (initialized from config) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Rotation")
+  ECursorAimMode CursorAimMode = ECursorAimMode::GroundPlane;
+
   // ============================================
   // Internal Methods
   // ============================================
@@ -89,6 +99,27 @@ protected:
   /** Apply settings to components */
   void ApplyCameraSettings();
 
+  /** Wait for the config and its input assets without blocking */
+  void RequestConfiguration();
+
+  /** Config and input assets are loaded: apply settings and bind input */
+  void OnConfigurationLoaded();
+
+  /** Add the config's mapping context for the local player */
+  void AddInputMappingContext();
+
+  /** Bind input actions once both the config and input component exist */
+  void BindInputActions();
+
+  /** Keeps ConfigOverride's input assets loaded */
+  TSharedPtr<FStreamableHandle> ConfigInputsHandle;
+
+  /** Input component waiting for the config */
+  TWeakObjectPtr<UEnhancedInputComponent> PendingInputComponent;
+
+  /** Config and its input assets are loaded */
+  bool bConfigurationReady = false;
+
   // ============================================
   // Input Handlers
   // ============================================
@@ -106,8 +137,30 @@ protected:
   /** Update character rotation to face mouse cursor */
   void UpdateCharacterRotation();
 
-  /** Get the world location under the mouse cursor */
-  bool GetMouseWorldLocation(FVector &OutLocation) const;
+  /** Get the world location under the mouse cursor (see CursorAimMode) */
+  bool GetMouseWorldLocation(FVector &OutLocation);
+
+  /** Issue an async refinement trace if the cursor ray changed */
+  void RequestCursorTrace(const FVector &RayOrigin, const FVector &RayEnd);
+
+  /** Async refinement trace finished */
+  void OnCursorTraceCompleted(const FTraceHandle &TraceHandle,
+                              FTraceDatum &TraceDatum);
+
+  /** Cursor ray of the last aim update */
+  FVector LastCursorRayOrigin = FVector::ZeroVector;
+  FVector LastCursorRayEnd = FVector::ZeroVector;
+
+  /** Trace hit for the current cursor ray (valid until the ray changes) */
+  FVector RefinedCursorLocation = FVector::ZeroVector;
+  bool bHasRefinedCursorLocation = false;
+
+  /** The current cursor ray has been traced (hit or miss) */
+  bool bCursorRayTraced = false;
+
+  /** In-flight refinement trace */
+  FTraceHandle CursorTraceHandle;
+  FTraceDelegate CursorTraceDelegate;
 
 public:
   // ============================================
@@ -0,0 +1,144 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TopDownLoadTestGameMode.h"
+#include "CharacterSystem.h"
+#include "Engine/World.h"
+#include "InteractionDetectorComponent.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "TopDownBotController.h"
+#include "TopDownCharacter.h"
+#include "TopDownWalker.h"
+
+CSV_DEFINE_CATEGORY(LoadTest, true);
+
+ATopDownLoadTestGameMode::ATopDownLoadTestGameMode() {
+  PrimaryActorTick.bCanEverTick = true;
+  BotClass = ATopDownCharacter::StaticClass();
+  BotControllerClass = ATopDownBotController::StaticClass();
+}
+
+void ATopDownLoadTestGameMode::StartPlay() {
+  Super::StartPlay();
+
+  const TCHAR *CommandLine = FCommandLine::Get();
+  FParse::Value(CommandLine, TEXT("BotCount="), BotCount);
+  FParse::Value(CommandLine, TEXT("LoadTestSeconds="), DurationSeconds);
+  FParse::Value(CommandLine, TEXT("LoadTestSeed="), Seed);
+  if (FParse::Param(CommandLine, TEXT("LoadTestWalkers"))) {
+    BotClass = ATopDownWalker::StaticClass();
+  }
+
+  SpawnBots();
+
+#if CSV_PROFILER
+  if (bRecordCsv && !FCsvProfiler::Get()->IsCapturing()) {
+    FCsvProfiler::Get()->BeginCapture(
+        -1, FString(), FString::Printf(TEXT("LoadTest_%dBots.csv"), BotCount));
+  }
+#endif
+
+  bRunning = true;
+  UE_LOG(LogCharacterSystem, Display, TEXT("Load test started: %d bots, %.0f s"),
+         Bots.Num(), DurationSeconds);
+}
+
+void ATopDownLoadTestGameMode::SpawnBots() {
+  LLM_SCOPE_BYTAG(CharacterSystem);
+  if (!BotClass || !BotControllerClass) {
+    return;
+  }
+
+  const AActor *Start = FindPlayerStart(nullptr);
+  const FVector Center =
+      Start ? Start->GetActorLocation() : FVector(0.f, 0.f, 100.f);
+
+  FRandomStream Random(Seed);
+  FActorSpawnParameters SpawnParams;
+  SpawnParams.SpawnCollisionHandlingOverride =
+      ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+  Bots.Reserve(BotCount);
+  for (int32 Index = 0; Index < BotCount; ++Index) {
+    const FVector2D Offset = FVector2D(Random.GetUnitVector()).GetSafeNormal() *
+                             SpawnRadius * FMath::Sqrt(Random.FRand());
+    const FVector Location = Center + FVector(Offset, 0.f);
+    const FRotator Rotation(0.f, Random.FRandRange(0.f, 360.f), 0.f);
+
+    APawn *Bot = GetWorld()->SpawnActor<APawn>(
+        BotClass, Location, Rotation, SpawnParams);
+    if (!Bot) {
+      continue;
+    }
+
+    // The native class has no detector; Blueprints usually add one
+    if (!Bot->FindComponentByClass<UInteractionDetectorComponent>()) {
+      UInteractionDetectorComponent *Detector =
+          NewObject<UInteractionDetectorComponent>(Bot);
+      Detector->RegisterComponent();
+      Bot->AddInstanceComponent(Detector);
+    }
+
+    ATopDownBotController *BotController =
+        GetWorld()->SpawnActor<ATopDownBotController>(
+            BotControllerClass, Location, Rotation, SpawnParams);
+    if (!BotController) {
+      Bot->Destroy();
+      continue;
+    }
+    BotController->InitializeBot(Seed + Index, Center, SpawnRadius);
+    BotController->Possess(Bot);
+    Bots.Add(BotController);
+  }
+}
+
+void ATopDownLoadTestGameMode::Tick(float DeltaSeconds) {
+  Super::Tick(DeltaSeconds);
+  if (!bRunning) {
+    return;
+  }
+
+  // Undilated frame time, the same value the CSV FrameTime column uses
+  const double FrameSeconds = FApp::GetDeltaTime();
+  ElapsedSeconds += FrameSeconds;
+  TotalFrameSeconds += FrameSeconds;
+  MaxFrameSeconds = FMath::Max(MaxFrameSeconds, FrameSeconds);
+  ++NumFrames;
+  CSV_CUSTOM_STAT(LoadTest, BotCount, Bots.Num(), ECsvCustomStatOp::Set);
+
+  if (DurationSeconds > 0.f && ElapsedSeconds >= DurationSeconds) {
+    FinishLoadTest(true);
+  }
+}
+
+void ATopDownLoadTestGameMode::EndPlay(
+    const EEndPlayReason::Type EndPlayReason) {
+  if (bRunning) {
+    FinishLoadTest(false);
+  }
+  Super::EndPlay(EndPlayReason);
+}
+
+void ATopDownLoadTestGameMode::FinishLoadTest(bool bAllowQuit) {
+  bRunning = false;
+
+#if CSV_PROFILER
+  if (bRecordCsv && FCsvProfiler::Get()->IsCapturing()) {
+    FCsvProfiler::Get()->EndCapture();
+  }
+#endif
+
+  const double AverageMs =
+      NumFrames > 0 ? TotalFrameSeconds * 1000.0 / NumFrames : 0.0;
+  UE_LOG(LogCharacterSystem, Display,
+         TEXT("Load test finished: %d bots, %lld frames in %.1f s, frame "
+              "avg %.2f ms max %.2f ms"),
+         Bots.Num(), NumFrames, ElapsedSeconds, AverageMs,
+         MaxFrameSeconds * 1000.0);
+
+  // Never close the editor from PIE
+  if (bAllowQuit && bQuitWhenDone && !GIsEditor) {
+    FPlatformMisc::RequestExit(false, TEXT("TopDownLoadTest"));
+  }
+}
@@ -0,0 +1,88 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/GameModeBase.h"
+#include "TopDownLoadTestGameMode.generated.h"
+
+class ATopDownBotController;
+
+/**
+ * Game mode that spawns N scripted top-down bots and records timings.
+ * Select it with ?game=/Script/CharacterSystem.TopDownLoadTestGameMode and
+ * run headless with -nullrhi. Command line overrides:
+ *   -BotCount=N  -LoadTestSeconds=S  -LoadTestSeed=N
+ *   -LoadTestWalkers (spawn ATopDownWalker instead of BotClass)
+ * A CSV profiler capture (frame, game thread and Interaction/LoadTest
+ * timings) runs for the whole test; the game exits when it ends.
+ */
+UCLASS()
+class CHARACTERSYSTEM_API ATopDownLoadTestGameMode : public AGameModeBase {
+  GENERATED_BODY()
+
+public:
+  ATopDownLoadTestGameMode();
+
+  virtual void StartPlay() override;
+  virtual void Tick(float DeltaSeconds) override;
+  virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+protected:
+  // ============================================
+  // Load Test Settings
+  // ============================================
+
+  /** Pawn spawned for each bot (character Blueprint, or ATopDownWalker) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Load Test")
+  TSubclassOf<APawn> BotClass;
+
+  /** Controller driving each bot */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Load Test")
+  TSubclassOf<ATopDownBotController> BotControllerClass;
+
+  /** Number of bots (-BotCount=) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Load Test",
+            meta = (ClampMin = "0"))
+  int32 BotCount = 50;
+
+  /** Bots spawn and wander within this radius of the player start */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Load Test",
+            meta = (ClampMin = "100.0"))
+  float SpawnRadius = 2000.f;
+
+  /** Test length in seconds, 0 = until quit (-LoadTestSeconds=) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Load Test",
+            meta = (ClampMin = "0.0"))
+  float DurationSeconds = 60.f;
+
+  /** Seed for spawn positions and bot behaviour (-LoadTestSeed=) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Load Test")
+  int32 Seed = 1;
+
+  /** Record a CSV profiler capture for the test */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Load Test")
+  bool bRecordCsv = true;
+
+  /** Exit the game when DurationSeconds has elapsed */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Load Test")
+  bool bQuitWhenDone = true;
+
+private:
+  /** Spawn and possess all bots */
+  void SpawnBots();
+
+  /** Stop the capture, log the summary and optionally quit */
+  void FinishLoadTest(bool bAllowQuit);
+
+  UPROPERTY(Transient)
+  TArray<TObjectPtr<ATopDownBotController>> Bots;
+
+  /** Frame statistics since StartPlay */
+  double ElapsedSeconds = 0.0;
+  double TotalFrameSeconds = 0.0;
+  double MaxFrameSeconds = 0.0;
+  int64 NumFrames = 0;
+
+  bool bRunning = false;
+};
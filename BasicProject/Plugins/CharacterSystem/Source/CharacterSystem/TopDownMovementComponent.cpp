@@ -0,0 +1,90 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TopDownMovementComponent.h"
+#include "CharacterSystemConfig.h"
+#include "Engine/World.h"
+#include "TopDownMovementSubsystem.h"
+
+UTopDownMovementComponent::UTopDownMovementComponent() {
+  // Stepped in batch by UTopDownMovementSubsystem
+  PrimaryComponentTick.bCanEverTick = false;
+
+  // Movement stays on the horizontal plane it starts on
+  bConstrainToPlane = true;
+  bSnapToPlaneAtStart = true;
+  SetPlaneConstraintNormal(FVector::UpVector);
+}
+
+void UTopDownMovementComponent::BeginPlay() {
+  Super::BeginPlay();
+
+  if (UTopDownMovementSubsystem *Subsystem =
+          GetWorld()->GetSubsystem<UTopDownMovementSubsystem>()) {
+    Subsystem->Register(this);
+  }
+}
+
+void UTopDownMovementComponent::EndPlay(
+    const EEndPlayReason::Type EndPlayReason) {
+  if (UTopDownMovementSubsystem *Subsystem =
+          GetWorld()->GetSubsystem<UTopDownMovementSubsystem>()) {
+    Subsystem->Unregister(this);
+  }
+  Super::EndPlay(EndPlayReason);
+}
+
+void UTopDownMovementComponent::ApplyConfig(
+    const UCharacterSystemConfig *Config) {
+  if (Config) {
+    MaxWalkSpeed = Config->MaxWalkSpeed;
+    MaxAcceleration = Config->MaxAcceleration;
+    BrakingDeceleration = Config->BrakingDeceleration;
+    RotationRate = Config->OrientRotationRate;
+  }
+}
+
+void UTopDownMovementComponent::StepMovement(float DeltaTime) {
+  if (!UpdatedComponent || !PawnOwner || ShouldSkipUpdate(DeltaTime)) {
+    return;
+  }
+
+  // Accelerate toward the input, brake without it
+  const FVector Input = ConsumeInputVector().GetClampedToMaxSize(1.f);
+  const FVector FlatInput(Input.X, Input.Y, 0.f);
+  if (!FlatInput.IsNearlyZero()) {
+    const FVector DesiredVelocity = FlatInput * MaxWalkSpeed;
+    const FVector VelocityDelta = DesiredVelocity - Velocity;
+    Velocity += VelocityDelta.GetClampedToMaxSize(MaxAcceleration * DeltaTime);
+  } else {
+    const float Speed = Velocity.Size();
+    const float NewSpeed = FMath::Max(0.f, Speed - BrakingDeceleration * DeltaTime);
+    Velocity = Speed > UE_KINDA_SMALL_NUMBER ? Velocity * (NewSpeed / Speed)
+                                             : FVector::ZeroVector;
+  }
+  Velocity.Z = 0.f;
+
+  const FVector Delta = Velocity * DeltaTime;
+  if (Delta.IsNearlyZero()) {
+    UpdateComponentVelocity();
+    return;
+  }
+
+  FQuat Rotation = UpdatedComponent->GetComponentQuat();
+  if (bOrientRotationToMovement) {
+    Rotation = FMath::RInterpConstantTo(Rotation.Rotator(), Velocity.Rotation(),
+                                        DeltaTime, RotationRate)
+                   .Quaternion();
+  }
+
+  // Sweep, then slide once along whatever blocked us
+  FHitResult Hit;
+  SafeMoveUpdatedComponent(Delta, Rotation, true, Hit);
+  if (Hit.IsValidBlockingHit()) {
+    const FVector WallNormal = FVector(Hit.Normal.X, Hit.Normal.Y, 0.f)
+                                   .GetSafeNormal();
+    SlideAlongSurface(Delta, 1.f - Hit.Time, WallNormal, Hit, true);
+    Velocity = FVector::VectorPlaneProject(Velocity, WallNormal);
+  }
+
+  UpdateComponentVelocity();
+}
@@ -0,0 +1,76 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/PawnMovementComponent.h"
+#include "TopDownMovementComponent.generated.h"
+
+class UCharacterSystemConfig;
+
+/**
+ * Lightweight kinematic movement for flat, plane-constrained top-down agents.
+ * Accelerates toward the pending movement input and sweeps with slide against
+ * blocking geometry. No floor finding, physics volumes, jumping or network
+ * prediction. Components do not tick themselves: UTopDownMovementSubsystem
+ * steps every registered component in one batched loop per frame.
+ */
+UCLASS(ClassGroup = (Movement), meta = (BlueprintSpawnableComponent))
+class CHARACTERSYSTEM_API UTopDownMovementComponent
+    : public UPawnMovementComponent {
+  GENERATED_BODY()
+
+public:
+  UTopDownMovementComponent();
+
+  //~ Begin UActorComponent Interface
+  virtual void BeginPlay() override;
+  virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+  //~ End UActorComponent Interface
+
+  //~ Begin UMovementComponent Interface
+  virtual float GetMaxSpeed() const override { return MaxWalkSpeed; }
+  //~ End UMovementComponent Interface
+
+  /** Take speed and acceleration values from a config */
+  void ApplyConfig(const UCharacterSystemConfig *Config);
+
+  /** Advance one step (called by UTopDownMovementSubsystem) */
+  void StepMovement(float DeltaTime);
+
+public:
+  // ============================================
+  // Movement Settings
+  // ============================================
+
+  /** Maximum ground speed in cm/s */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Top Down Movement",
+            meta = (ClampMin = "0.0"))
+  float MaxWalkSpeed = 600.f;
+
+  /** Acceleration toward the input direction in cm/s^2 */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Top Down Movement",
+            meta = (ClampMin = "0.0"))
+  float MaxAcceleration = 2048.f;
+
+  /** Deceleration without input in cm/s^2 */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Top Down Movement",
+            meta = (ClampMin = "0.0"))
+  float BrakingDeceleration = 2048.f;
+
+  /** Turn the updated component toward its velocity */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Top Down Movement")
+  bool bOrientRotationToMovement = true;
+
+  /** Yaw rate in degrees per second when orienting to movement */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Top Down Movement",
+            meta = (ClampMin = "0.0", EditCondition = "bOrientRotationToMovement"))
+  float RotationRate = 540.f;
+
+private:
+  friend class UTopDownMovementSubsystem;
+
+  /** Slot in UTopDownMovementSubsystem's dense array (INDEX_NONE if not
+   * registered) */
+  int32 SubsystemIndex = INDEX_NONE;
+};
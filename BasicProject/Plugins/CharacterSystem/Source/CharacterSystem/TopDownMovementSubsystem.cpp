@@ -0,0 +1,79 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TopDownMovementSubsystem.h"
+#include "CharacterSystem.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "TopDownMovementComponent.h"
+
+CSV_DEFINE_CATEGORY(TopDownMovement, true);
+
+void UTopDownMovementSubsystem::Deinitialize() {
+  for (UTopDownMovementComponent *Component : Components) {
+    if (Component) {
+      Component->SubsystemIndex = INDEX_NONE;
+    }
+  }
+  Components.Empty();
+  Super::Deinitialize();
+}
+
+void UTopDownMovementSubsystem::Tick(float DeltaTime) {
+  Super::Tick(DeltaTime);
+  CSV_SCOPED_TIMING_STAT(TopDownMovement, Step);
+  CSV_CUSTOM_STAT(TopDownMovement, Agents, Components.Num(),
+                  ECsvCustomStatOp::Set);
+
+  // Moves can end play on other agents (overlaps, gameplay); those are
+  // cleared in place and compacted afterwards
+  {
+    TGuardValue<bool> SteppingGuard(bStepping, true);
+    for (int32 Index = 0; Index < Components.Num(); ++Index) {
+      if (UTopDownMovementComponent *Component = Components[Index]) {
+        Component->StepMovement(DeltaTime);
+      }
+    }
+  }
+
+  // Compact in order, moving each survivor's stored index along
+  if (bHasClearedEntries) {
+    int32 NumKept = 0;
+    for (UTopDownMovementComponent *Component : Components) {
+      if (Component) {
+        Component->SubsystemIndex = NumKept;
+        Components[NumKept++] = Component;
+      }
+    }
+    Components.SetNum(NumKept, EAllowShrinking::No);
+    bHasClearedEntries = false;
+  }
+}
+
+TStatId UTopDownMovementSubsystem::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(UTopDownMovementSubsystem, STATGROUP_Tickables);
+}
+
+void UTopDownMovementSubsystem::Register(UTopDownMovementComponent *Component) {
+  LLM_SCOPE_BYTAG(CharacterSystem);
+  if (Component && Component->SubsystemIndex == INDEX_NONE) {
+    Component->SubsystemIndex = Components.Add(Component);
+  }
+}
+
+void UTopDownMovementSubsystem::Unregister(
+    UTopDownMovementComponent *Component) {
+  const int32 Index = Component ? Component->SubsystemIndex : INDEX_NONE;
+  if (!Components.IsValidIndex(Index) || Components[Index] != Component) {
+    return;
+  }
+  Component->SubsystemIndex = INDEX_NONE;
+
+  if (bStepping) {
+    Components[Index] = nullptr;
+    bHasClearedEntries = true;
+  } else {
+    Components.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    if (Components.IsValidIndex(Index) && Components[Index]) {
+      Components[Index]->SubsystemIndex = Index;
+    }
+  }
+}
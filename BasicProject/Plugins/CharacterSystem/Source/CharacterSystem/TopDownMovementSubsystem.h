@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TopDownMovementSubsystem.generated.h"
+
+class UTopDownMovementComponent;
+
+/**
+ * Steps every UTopDownMovementComponent of the world in one loop per frame.
+ * One tickable instead of one tick function per agent keeps thousands of
+ * walkers out of the tick task manager.
+ */
+UCLASS()
+class CHARACTERSYSTEM_API UTopDownMovementSubsystem
+    : public UTickableWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  // ============================================
+  // USubsystem / FTickableGameObject Interface
+  // ============================================
+
+  virtual void Deinitialize() override;
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+
+  // ============================================
+  // Registration
+  // ============================================
+
+  /** Start stepping a component */
+  void Register(UTopDownMovementComponent *Component);
+
+  /** Stop stepping a component */
+  void Unregister(UTopDownMovementComponent *Component);
+
+  /** Number of registered components */
+  int32 Num() const { return Components.Num(); }
+
+private:
+  /** Registered components, stepped in order; each component stores its
+   * index for O(1) removal */
+  UPROPERTY(Transient)
+  TArray<TObjectPtr<UTopDownMovementComponent>> Components;
+
+  /** Inside the step loop; removals are deferred */
+  bool bStepping = false;
+
+  /** Entries were cleared during the step loop */
+  bool bHasClearedEntries = false;
+};
@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TopDownWalker.h"
+#include "CharacterSystem.h"
+#include "CharacterSystemSubsystem.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/GameInstance.h"
+#include "InteractionDetectorComponent.h"
+#include "TopDownMovementComponent.h"
+
+ATopDownWalker::ATopDownWalker() {
+  // Movement is stepped by UTopDownMovementSubsystem; the actor never ticks
+  PrimaryActorTick.bCanEverTick = false;
+
+  Capsule = CreateDefaultSubobject<UCapsuleComponent>(TEXT("Capsule"));
+  Capsule->InitCapsuleSize(34.f, 88.f);
+  Capsule->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+  Capsule->SetCollisionObjectType(ECC_Pawn);
+  Capsule->SetCollisionResponseToAllChannels(ECR_Ignore);
+  Capsule->SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Block);
+  Capsule->SetGenerateOverlapEvents(false);
+  Capsule->SetCanEverAffectNavigation(false);
+  RootComponent = Capsule;
+
+  Movement =
+      CreateDefaultSubobject<UTopDownMovementComponent>(TEXT("Movement"));
+  Movement->UpdatedComponent = Capsule;
+
+  Detector =
+      CreateDefaultSubobject<UInteractionDetectorComponent>(TEXT("Detector"));
+
+  AutoPossessAI = EAutoPossessAI::Disabled;
+}
+
+UPawnMovementComponent *ATopDownWalker::GetMovementComponent() const {
+  return Movement;
+}
+
+void ATopDownWalker::BeginPlay() {
+  LLM_SCOPE_BYTAG(CharacterSystem);
+  Super::BeginPlay();
+
+  const UGameInstance *GameInstance = GetGameInstance();
+  if (UCharacterSystemSubsystem *Subsystem =
+          GameInstance ? GameInstance->GetSubsystem<UCharacterSystemSubsystem>()
+                       : nullptr) {
+    Subsystem->CallOrRegister_OnConfigLoaded(FSimpleDelegate::CreateUObject(
+        this, &ATopDownWalker::OnConfigurationLoaded));
+  }
+}
+
+void ATopDownWalker::OnConfigurationLoaded() {
+  if (const UGameInstance *GameInstance = GetGameInstance()) {
+    if (const UCharacterSystemSubsystem *Subsystem =
+            GameInstance->GetSubsystem<UCharacterSystemSubsystem>()) {
+      Movement->ApplyConfig(Subsystem->GetConfig());
+    }
+  }
+}
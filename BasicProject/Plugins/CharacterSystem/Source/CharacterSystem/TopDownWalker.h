@@ -0,0 +1,53 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Pawn.h"
+#include "TopDownWalker.generated.h"
+
+class UCapsuleComponent;
+class UInteractionDetectorComponent;
+class UTopDownMovementComponent;
+
+/**
+ * Cheap top-down agent for crowds and load tests.
+ * A capsule moved by UTopDownMovementComponent (batched, sweep-and-slide
+ * against static geometry) plus an interaction detector. Driven through
+ * AddMovementInput like ATopDownCharacter and configured from the same
+ * CharacterSystemConfig.
+ */
+UCLASS()
+class CHARACTERSYSTEM_API ATopDownWalker : public APawn {
+  GENERATED_BODY()
+
+public:
+  ATopDownWalker();
+
+  virtual UPawnMovementComponent *GetMovementComponent() const override;
+
+protected:
+  virtual void BeginPlay() override;
+
+  /** Apply the project config once it has loaded */
+  void OnConfigurationLoaded();
+
+  // ============================================
+  // Components
+  // ============================================
+
+  /** Collision capsule (blocks static geometry only) */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components",
+            meta = (AllowPrivateAccess = "true"))
+  TObjectPtr<UCapsuleComponent> Capsule;
+
+  /** Batched kinematic movement */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components",
+            meta = (AllowPrivateAccess = "true"))
+  TObjectPtr<UTopDownMovementComponent> Movement;
+
+  /** Interaction detection */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components",
+            meta = (AllowPrivateAccess = "true"))
+  TObjectPtr<UInteractionDetectorComponent> Detector;
+};
@@ -0,0 +1,196 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "InteractionMassProcessors.h"
+#include "InteractionMassFragments.h"
+#include "InteractionMassSubsystem.h"
+#include "InteractionMath.h"
+#include "InteractionSettings.h"
+#include "MassExecutionContext.h"
+
+namespace InteractionMassProcessors {
+struct FChunkBest {
+  uint64 Entity = 0;
+  FInteractionTypeId TypeId = 0;
+  float DistanceSq = 0.0f;
+};
+} // namespace InteractionMassProcessors
+
+// ============================================
+// Detection
+// ============================================
+
+UInteractionMassDetectionProcessor::UInteractionMassDetectionProcessor()
+    : EntityQuery(*this) {
+  bAutoRegisterWithProcessingPhases = false;
+  ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+}
+
+void UInteractionMassDetectionProcessor::ConfigureQueries(
+    const TSharedRef<FMassEntityManager> &EntityManager) {
+  EntityQuery.AddRequirement<FInteractableLocationFragment>(
+      EMassFragmentAccess::ReadOnly);
+  EntityQuery.AddRequirement<FInteractableTypeFragment>(
+      EMassFragmentAccess::ReadOnly);
+  EntityQuery.AddRequirement<FInteractableStateFragment>(
+      EMassFragmentAccess::ReadWrite);
+  EntityQuery.AddTagRequirement<FInteractableMassTag>(EMassFragmentPresence::All);
+}
+
+void UInteractionMassDetectionProcessor::Execute(
+    FMassEntityManager &EntityManager, FMassExecutionContext &Context) {
+  using InteractionMassProcessors::FChunkBest;
+
+  UInteractionMassSubsystem *Subsystem =
+      Cast<UInteractionMassSubsystem>(GetOuter());
+  if (!Subsystem) {
+    return;
+  }
+
+  // Viewer inputs are read-only here; best targets are merged per chunk
+  TArrayView<FInteractionMassViewer> Viewers = Subsystem->GetViewers();
+
+  EntityQuery.ParallelForEachEntityChunk(
+      Context, [this, Viewers](FMassExecutionContext &ChunkContext) {
+        const TConstArrayView<FInteractableLocationFragment> Locations =
+            ChunkContext.GetFragmentView<FInteractableLocationFragment>();
+        const TConstArrayView<FInteractableTypeFragment> Types =
+            ChunkContext.GetFragmentView<FInteractableTypeFragment>();
+        const TArrayView<FInteractableStateFragment> States =
+            ChunkContext.GetMutableFragmentView<FInteractableStateFragment>();
+
+        TArray<FChunkBest, TInlineAllocator<8>> ChunkBest;
+        ChunkBest.SetNum(Viewers.Num());
+
+        // Lay the chunk's locations out for the InteractionMath kernels
+        const int32 NumEntities = ChunkContext.GetNumEntities();
+        TArray<FVector, TInlineAllocator<128>> ChunkLocations;
+        TArray<int32, TInlineAllocator<128>> Indices;
+        ChunkLocations.SetNumUninitialized(NumEntities);
+        Indices.SetNumUninitialized(NumEntities);
+        for (int32 i = 0; i < NumEntities; ++i) {
+          ChunkLocations[i] = Locations[i].Location;
+          States[i].bVisible = false;
+        }
+
+        for (int32 v = 0; v < Viewers.Num(); ++v) {
+          const FInteractionMassViewer &Viewer = Viewers[v];
+          const int32 NumInside = InteractionMath::CullByDistance(
+              ChunkLocations, Viewer.Location, Viewer.VisibilityRadiusSq,
+              Indices.GetData());
+
+          // Drop the ones this viewer can't use, keeping the entity order
+          int32 NumVisible = 0;
+          for (int32 i = 0; i < NumInside; ++i) {
+            const int32 Index = Indices[i];
+            if (States[Index].bCanInteract &&
+                Viewer.Filter->Matches(Types[Index].TypeId)) {
+              States[Index].bVisible |= Viewer.bPresentation;
+              Indices[NumVisible++] = Index;
+            }
+          }
+
+          double DistanceSq = 0.0;
+          const int32 Nearest = InteractionMath::FindNearest(
+              ChunkLocations, MakeArrayView(Indices.GetData(), NumVisible),
+              Viewer.Location, Viewer.InteractionRadiusSq, DistanceSq);
+          if (Nearest != INDEX_NONE) {
+            ChunkBest[v].Entity = ChunkContext.GetEntity(Nearest).AsNumber();
+            ChunkBest[v].TypeId = Types[Nearest].TypeId;
+            ChunkBest[v].DistanceSq = static_cast<float>(DistanceSq);
+          }
+        }
+
+        FScopeLock Lock(&MergeLock);
+        for (int32 v = 0; v < Viewers.Num(); ++v) {
+          FInteractionMassViewer &Viewer = Viewers[v];
+          if (ChunkBest[v].Entity != 0 &&
+              (Viewer.BestEntity == 0 ||
+               ChunkBest[v].DistanceSq < Viewer.BestDistanceSq)) {
+            Viewer.BestEntity = ChunkBest[v].Entity;
+            Viewer.BestTypeId = ChunkBest[v].TypeId;
+            Viewer.BestDistanceSq = ChunkBest[v].DistanceSq;
+          }
+        }
+      });
+}
+
+// ============================================
+// Marker Animation
+// ============================================
+
+UInteractionMassMarkerProcessor::UInteractionMassMarkerProcessor()
+    : EntityQuery(*this) {
+  bAutoRegisterWithProcessingPhases = false;
+  // The subsystem skips this processor on headless worlds
+  ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+}
+
+void UInteractionMassMarkerProcessor::ConfigureQueries(
+    const TSharedRef<FMassEntityManager> &EntityManager) {
+  EntityQuery.AddRequirement<FInteractableLocationFragment>(
+      EMassFragmentAccess::ReadOnly);
+  EntityQuery.AddRequirement<FInteractableTypeFragment>(
+      EMassFragmentAccess::ReadOnly);
+  EntityQuery.AddRequirement<FInteractableStateFragment>(
+      EMassFragmentAccess::ReadOnly);
+  EntityQuery.AddRequirement<FInteractableMarkerFragment>(
+      EMassFragmentAccess::ReadWrite);
+  EntityQuery.AddTagRequirement<FInteractableMassTag>(EMassFragmentPresence::All);
+}
+
+void UInteractionMassMarkerProcessor::Execute(FMassEntityManager &EntityManager,
+                                              FMassExecutionContext &Context) {
+  UInteractionMassSubsystem *Subsystem =
+      Cast<UInteractionMassSubsystem>(GetOuter());
+  if (!Subsystem) {
+    return;
+  }
+
+  float FadeDuration = 0.3f;
+  float Elasticity = 2.0f;
+  if (const UInteractionSettings *Settings = UInteractionSettings::Get()) {
+    FadeDuration = Settings->DefaultFadeDuration;
+    Elasticity = Settings->DefaultAnimationElasticity;
+  }
+
+  EntityQuery.ParallelForEachEntityChunk(
+      Context, [Subsystem, FadeDuration,
+                Elasticity](FMassExecutionContext &ChunkContext) {
+        const TConstArrayView<FInteractableLocationFragment> Locations =
+            ChunkContext.GetFragmentView<FInteractableLocationFragment>();
+        const TConstArrayView<FInteractableTypeFragment> Types =
+            ChunkContext.GetFragmentView<FInteractableTypeFragment>();
+        const TConstArrayView<FInteractableStateFragment> States =
+            ChunkContext.GetFragmentView<FInteractableStateFragment>();
+        const TArrayView<FInteractableMarkerFragment> Markers =
+            ChunkContext.GetMutableFragmentView<FInteractableMarkerFragment>();
+        const float DeltaTime = ChunkContext.GetDeltaTimeSeconds();
+
+        TArray<FInteractionMassMarker, TInlineAllocator<32>> ChunkMarkers;
+        for (int32 i = 0; i < ChunkContext.GetNumEntities(); ++i) {
+          FInteractableMarkerFragment &Marker = Markers[i];
+
+          // Start a fade whenever visibility flips
+          if (States[i].bVisible == Marker.Animation.IsHiding()) {
+            Marker.Animation.SetShown(States[i].bVisible);
+            Marker.bAnimating = true;
+          }
+          if (Marker.bAnimating) {
+            Marker.bAnimating =
+                !Marker.Animation.Step(DeltaTime, FadeDuration, Elasticity);
+          }
+
+          if (Marker.Animation.Opacity > 0.0f) {
+            FInteractionMassMarker &Visible = ChunkMarkers.AddDefaulted_GetRef();
+            Visible.Location = Locations[i].Location;
+            Visible.Opacity = Marker.Animation.Opacity;
+            Visible.Scale = Marker.Animation.Scale;
+            Visible.TypeId = Types[i].TypeId;
+          }
+        }
+
+        if (!ChunkMarkers.IsEmpty()) {
+          Subsystem->AppendVisibleMarkers(ChunkMarkers);
+        }
+      });
+}
@@ -0,0 +1,53 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityQuery.h"
+#include "MassProcessor.h"
+#include "InteractionMassProcessors.generated.h"
+
+/**
+ * Per-entity visibility and per-detector nearest target, in parallel chunks
+ * Run by UInteractionMassSubsystem, not by the processing phases.
+ */
+UCLASS()
+class UInteractionMassDetectionProcessor : public UMassProcessor {
+  GENERATED_BODY()
+
+public:
+  UInteractionMassDetectionProcessor();
+
+protected:
+  virtual void
+  ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) override;
+  virtual void Execute(FMassEntityManager &EntityManager,
+                       FMassExecutionContext &Context) override;
+
+private:
+  FMassEntityQuery EntityQuery;
+
+  /** Guards the merge of per-chunk best targets */
+  FCriticalSection MergeLock;
+};
+
+/**
+ * Marker fade/scale animation and visible marker gathering, in parallel chunks
+ * Skipped entirely on headless worlds.
+ */
+UCLASS()
+class UInteractionMassMarkerProcessor : public UMassProcessor {
+  GENERATED_BODY()
+
+public:
+  UInteractionMassMarkerProcessor();
+
+protected:
+  virtual void
+  ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) override;
+  virtual void Execute(FMassEntityManager &EntityManager,
+                       FMassExecutionContext &Context) override;
+
+private:
+  FMassEntityQuery EntityQuery;
+};
@@ -0,0 +1,231 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "InteractionMassSubsystem.h"
+#include "DrawDebugHelpers.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "InteractionDetectorComponent.h"
+#include "InteractionMassFragments.h"
+#include "InteractionMassProcessors.h"
+#include "InteractionProfiling.h"
+#include "InteractionRegistrySubsystem.h"
+#include "InteractionSettings.h"
+#include "MassEntityManager.h"
+#include "MassEntitySubsystem.h"
+#include "MassExecutor.h"
+#include "MassProcessingContext.h"
+
+namespace InteractionMassSubsystem {
+static bool bDrawMarkers = false;
+static FAutoConsoleVariableRef CVarDrawMarkers(
+    TEXT("Interaction.Mass.DrawMarkers"), bDrawMarkers,
+    TEXT("Draw debug points for visible MassEntity interactable markers."));
+} // namespace InteractionMassSubsystem
+
+void UInteractionMassSubsystem::Initialize(FSubsystemCollectionBase &Collection) {
+  Super::Initialize(Collection);
+
+  UMassEntitySubsystem *EntitySubsystem =
+      Collection.InitializeDependency<UMassEntitySubsystem>();
+  if (!EntitySubsystem) {
+    return;
+  }
+
+  EntityManager = EntitySubsystem->GetMutableEntityManager().AsShared();
+  bHeadless = UInteractionSettings::IsHeadless(GetWorld());
+
+  Archetype = EntityManager->CreateArchetype(
+      {FInteractableLocationFragment::StaticStruct(),
+       FInteractableTypeFragment::StaticStruct(),
+       FInteractableStateFragment::StaticStruct(),
+       FInteractableMarkerFragment::StaticStruct(),
+       FInteractableMassTag::StaticStruct()});
+
+  // Processors are run from Tick rather than the processing phases, so no
+  // MassGameplay / MassSimulation setup is required
+  DetectionProcessor = NewObject<UInteractionMassDetectionProcessor>(this);
+  DetectionProcessor->CallInitialize(this, EntityManager.ToSharedRef());
+  MarkerProcessor = NewObject<UInteractionMassMarkerProcessor>(this);
+  MarkerProcessor->CallInitialize(this, EntityManager.ToSharedRef());
+}
+
+void UInteractionMassSubsystem::Deinitialize() {
+  Viewers.Empty();
+  VisibleMarkers.Empty();
+  DetectionProcessor = nullptr;
+  MarkerProcessor = nullptr;
+  EntityManager.Reset();
+  NumInteractables = 0;
+  Super::Deinitialize();
+}
+
+TStatId UInteractionMassSubsystem::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(UInteractionMassSubsystem, STATGROUP_Tickables);
+}
+
+void UInteractionMassSubsystem::Tick(float DeltaTime) {
+  Super::Tick(DeltaTime);
+  if (!EntityManager || NumInteractables == 0) {
+    return;
+  }
+
+  CSV_SCOPED_TIMING_STAT(Interaction, MassProcessing);
+  TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(MassProcessing, InteractionChannel);
+
+  VisibleMarkers.Reset();
+  GatherViewers();
+  INC_DWORD_STAT_BY(STAT_InteractionCandidatesScanned,
+                    NumInteractables * Viewers.Num());
+
+  TArray<UMassProcessor *, TInlineAllocator<2>> Processors;
+  Processors.Add(DetectionProcessor);
+  if (!bHeadless) {
+    Processors.Add(MarkerProcessor);
+  }
+
+  FMassProcessingContext ProcessingContext(*EntityManager, DeltaTime);
+  UE::Mass::Executor::RunProcessorsView(Processors, ProcessingContext);
+
+  ApplyViewerTargets();
+  INC_DWORD_STAT_BY(STAT_InteractionVisibleMarkers, VisibleMarkers.Num());
+
+  if (InteractionMassSubsystem::bDrawMarkers) {
+    for (const FInteractionMassMarker &Marker : VisibleMarkers) {
+      DrawDebugPoint(GetWorld(), Marker.Location, 10.0f * Marker.Scale,
+                     FColor::Cyan.WithAlpha(
+                         static_cast<uint8>(255.0f * Marker.Opacity)));
+    }
+  }
+}
+
+FMassEntityHandle UInteractionMassSubsystem::CreateInteractable(
+    const FVector &Location, FGameplayTag InteractionType, bool bCanInteract) {
+  LLM_SCOPE_BYTAG(Interaction_Detection);
+  if (!EntityManager) {
+    return FMassEntityHandle();
+  }
+
+  const FMassEntityHandle Entity = EntityManager->CreateEntity(Archetype);
+  EntityManager->GetFragmentDataChecked<FInteractableLocationFragment>(Entity)
+      .Location = Location;
+  EntityManager->GetFragmentDataChecked<FInteractableTypeFragment>(Entity)
+      .TypeId = FInteractionTypeRegistry::GetId(InteractionType);
+  EntityManager->GetFragmentDataChecked<FInteractableStateFragment>(Entity)
+      .bCanInteract = bCanInteract;
+  NumInteractables++;
+  return Entity;
+}
+
+void UInteractionMassSubsystem::CreateInteractables(
+    TConstArrayView<FVector> Locations, FGameplayTag InteractionType,
+    TArray<FMassEntityHandle> &OutEntities) {
+  LLM_SCOPE_BYTAG(Interaction_Detection);
+  if (!EntityManager || Locations.IsEmpty()) {
+    return;
+  }
+
+  const FInteractionTypeId TypeId =
+      FInteractionTypeRegistry::GetId(InteractionType);
+  const int32 FirstIndex = OutEntities.Num();
+  {
+    // Observers fire when the creation context goes out of scope
+    TSharedRef<FMassEntityManager::FEntityCreationContext> CreationContext =
+        EntityManager->BatchCreateEntities(Archetype, Locations.Num(),
+                                           OutEntities);
+    for (int32 i = 0; i < Locations.Num(); ++i) {
+      const FMassEntityHandle Entity = OutEntities[FirstIndex + i];
+      EntityManager->GetFragmentDataChecked<FInteractableLocationFragment>(
+                       Entity)
+          .Location = Locations[i];
+      EntityManager->GetFragmentDataChecked<FInteractableTypeFragment>(Entity)
+          .TypeId = TypeId;
+    }
+  }
+  NumInteractables += Locations.Num();
+}
+
+void UInteractionMassSubsystem::DestroyInteractable(FMassEntityHandle Entity) {
+  if (EntityManager && EntityManager->IsEntityValid(Entity)) {
+    EntityManager->DestroyEntity(Entity);
+    NumInteractables--;
+  }
+}
+
+void UInteractionMassSubsystem::SetCanInteract(FMassEntityHandle Entity,
+                                               bool bCanInteract) {
+  if (EntityManager && EntityManager->IsEntityValid(Entity)) {
+    EntityManager->GetFragmentDataChecked<FInteractableStateFragment>(Entity)
+        .bCanInteract = bCanInteract;
+  }
+}
+
+FMassEntityHandle UInteractionMassSubsystem::ResolveEntity(uint64 EntityId) const {
+  const FMassEntityHandle Entity = FMassEntityHandle::FromNumber(EntityId);
+  return EntityManager && EntityManager->IsEntityValid(Entity)
+             ? Entity
+             : FMassEntityHandle();
+}
+
+bool UInteractionMassSubsystem::GetInteractableLocation(
+    FMassEntityHandle Entity, FVector &OutLocation) const {
+  if (!EntityManager || !EntityManager->IsEntityValid(Entity)) {
+    return false;
+  }
+  OutLocation =
+      EntityManager->GetFragmentDataChecked<FInteractableLocationFragment>(
+                       Entity)
+          .Location;
+  return true;
+}
+
+void UInteractionMassSubsystem::AppendVisibleMarkers(
+    TConstArrayView<FInteractionMassMarker> Markers) {
+  FScopeLock Lock(&VisibleMarkersLock);
+  VisibleMarkers.Append(Markers.GetData(), Markers.Num());
+}
+
+void UInteractionMassSubsystem::GatherViewers() {
+  Viewers.Reset();
+
+  const UInteractionRegistrySubsystem *Registry =
+      GetWorld()->GetSubsystem<UInteractionRegistrySubsystem>();
+  if (!Registry) {
+    return;
+  }
+
+  for (UInteractionDetectorComponent *Detector : Registry->GetDetectors()) {
+    const AActor *Owner = Detector ? Detector->GetOwner() : nullptr;
+    if (!Owner || !Detector->IsActive()) {
+      continue;
+    }
+
+    // Matches() compiles lazily; finish that here so the parallel pass only
+    // reads the filter
+    const FInteractionTypeFilter &Filter = Detector->GetCompiledTypeFilter();
+    Filter.CompileRegisteredTypes();
+
+    const APawn *Pawn = Cast<APawn>(Owner);
+
+    FInteractionMassViewer &Viewer = Viewers.AddDefaulted_GetRef();
+    Viewer.Detector = Detector;
+    Viewer.Location = Owner->GetActorLocation();
+    Viewer.VisibilityRadiusSq = FMath::Square(Detector->VisibilityRadius);
+    Viewer.InteractionRadiusSq = FMath::Square(Detector->InteractionRadius);
+    Viewer.Filter = &Filter;
+    Viewer.bPresentation = !bHeadless && Pawn && Pawn->IsLocallyControlled();
+    Viewer.BestDistanceSq = Viewer.InteractionRadiusSq;
+  }
+}
+
+void UInteractionMassSubsystem::ApplyViewerTargets() {
+  for (const FInteractionMassViewer &Viewer : Viewers) {
+    if (UInteractionDetectorComponent *Detector = Viewer.Detector.Get()) {
+      FInteractionExternalTarget Target;
+      Target.EntityId = Viewer.BestEntity;
+      Target.TypeId = Viewer.BestTypeId;
+      Target.DistanceSq = Viewer.BestDistanceSq;
+      Detector->SetExternalTarget(Target);
+    }
+  }
+}
@@ -0,0 +1,67 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InteractionEvent.h"
+#include "InteractionMarkerAnimation.h"
+#include "MassEntityTypes.h"
+#include "InteractionMassFragments.generated.h"
+
+/**
+ * World position of an entity interactable
+ * 엔티티 상호작용 대상의 월드 위치
+ */
+USTRUCT()
+struct INTERACTIONMASS_API FInteractableLocationFragment : public FMassFragment {
+  GENERATED_BODY()
+
+  FVector Location = FVector::ZeroVector;
+};
+
+/**
+ * Interaction type of an entity interactable
+ * 엔티티 상호작용 대상의 타입
+ */
+USTRUCT()
+struct INTERACTIONMASS_API FInteractableTypeFragment : public FMassFragment {
+  GENERATED_BODY()
+
+  FInteractionTypeId TypeId = 0;
+};
+
+/**
+ * Interaction state of an entity interactable
+ * 엔티티 상호작용 대상의 상태
+ */
+USTRUCT()
+struct INTERACTIONMASS_API FInteractableStateFragment : public FMassFragment {
+  GENERATED_BODY()
+
+  /** Can currently be interacted with */
+  bool bCanInteract = true;
+
+  /** Within the visibility radius of a local viewer (written by detection) */
+  bool bVisible = false;
+};
+
+/**
+ * Marker animation of an entity interactable (presentation only)
+ * 엔티티 상호작용 대상의 마커 애니메이션 (표시 전용)
+ */
+USTRUCT()
+struct INTERACTIONMASS_API FInteractableMarkerFragment : public FMassFragment {
+  GENERATED_BODY()
+
+  FInteractionMarkerAnimation Animation;
+  bool bAnimating = false;
+};
+
+/**
+ * Identifies entities created by UInteractionMassSubsystem
+ * UInteractionMassSubsystem이 생성한 엔티티 태그
+ */
+USTRUCT()
+struct INTERACTIONMASS_API FInteractableMassTag : public FMassTag {
+  GENERATED_BODY()
+};
@@ -0,0 +1,139 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "InteractionEvent.h"
+#include "MassArchetypeTypes.h"
+#include "MassEntityTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "InteractionMassSubsystem.generated.h"
+
+class UInteractionDetectorComponent;
+class UInteractionMassDetectionProcessor;
+class UInteractionMassMarkerProcessor;
+struct FMassEntityManager;
+
+/**
+ * Detector snapshot used by the processors for one frame
+ * Inputs are copied on the game thread; the best target is merged from chunks
+ *
+ * 프로세서가 한 프레임 동안 사용하는 탐지기 스냅샷
+ */
+struct FInteractionMassViewer {
+  TWeakObjectPtr<UInteractionDetectorComponent> Detector;
+  FVector Location = FVector::ZeroVector;
+  float VisibilityRadiusSq = 0.0f;
+  float InteractionRadiusSq = 0.0f;
+
+  /** Detector's compiled filter (read-only during processing) */
+  const FInteractionTypeFilter *Filter = nullptr;
+
+  /** Drives marker visibility (locally controlled, not headless) */
+  bool bPresentation = false;
+
+  /** Nearest interactable entity within InteractionRadius */
+  uint64 BestEntity = 0;
+  FInteractionTypeId BestTypeId = 0;
+  float BestDistanceSq = 0.0f;
+};
+
+/**
+ * Visible entity marker, gathered for whatever renders entity markers
+ * 엔티티 마커 렌더러용 가시 마커 정보
+ */
+struct FInteractionMassMarker {
+  FVector Location = FVector::ZeroVector;
+  float Opacity = 0.0f;
+  float Scale = 0.0f;
+  FInteractionTypeId TypeId = 0;
+};
+
+/**
+ * Optional MassEntity path for very large numbers of interactables
+ * Entity interactables are plain fragments (location, type, state, marker
+ * animation). Each frame two processors run in parallel over chunks:
+ * detection (visibility + nearest target per detector) and marker animation.
+ * Detectors pick up the nearest entity as an external target, and
+ * interacting routes the usual FInteractionEvent (TargetEntity set).
+ * Actor content keeps using UInteractableComponent.
+ *
+ * 대량 상호작용 대상을 위한 선택적 MassEntity 경로
+ * 엔티티는 프래그먼트만 가지며, 매 프레임 탐지와 마커 애니메이션 프로세서가
+ * 청크 단위로 병렬 실행됩니다. 상호작용은 동일한 라우터로 전달됩니다.
+ */
+UCLASS()
+class INTERACTIONMASS_API UInteractionMassSubsystem
+    : public UTickableWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  //~ Begin USubsystem Interface
+  virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+  virtual void Deinitialize() override;
+  //~ End USubsystem Interface
+
+  //~ Begin FTickableGameObject Interface
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+  //~ End FTickableGameObject Interface
+
+  /** Create one entity interactable */
+  FMassEntityHandle CreateInteractable(const FVector &Location,
+                                       FGameplayTag InteractionType,
+                                       bool bCanInteract = true);
+
+  /** Create many entity interactables of one type in a single batch */
+  void CreateInteractables(TConstArrayView<FVector> Locations,
+                           FGameplayTag InteractionType,
+                           TArray<FMassEntityHandle> &OutEntities);
+
+  /** Destroy an entity interactable */
+  void DestroyInteractable(FMassEntityHandle Entity);
+
+  /** Enable or disable interaction with an entity */
+  void SetCanInteract(FMassEntityHandle Entity, bool bCanInteract);
+
+  /** Resolve the packed id carried by FInteractionEvent::TargetEntity */
+  FMassEntityHandle ResolveEntity(uint64 EntityId) const;
+
+  /** Location of an entity interactable */
+  bool GetInteractableLocation(FMassEntityHandle Entity,
+                               FVector &OutLocation) const;
+
+  /** Markers visible after the last update */
+  TConstArrayView<FInteractionMassMarker> GetVisibleMarkers() const {
+    return VisibleMarkers;
+  }
+
+  /** Number of live entity interactables */
+  int32 Num() const { return NumInteractables; }
+
+  //~ Processor access (valid during Tick)
+  TArrayView<FInteractionMassViewer> GetViewers() { return Viewers; }
+  void AppendVisibleMarkers(TConstArrayView<FInteractionMassMarker> Markers);
+
+private:
+  /** Snapshot detectors from the registry */
+  void GatherViewers();
+
+  /** Hand each detector its nearest entity */
+  void ApplyViewerTargets();
+
+  TSharedPtr<FMassEntityManager> EntityManager;
+  FMassArchetypeHandle Archetype;
+
+  UPROPERTY(Transient)
+  TObjectPtr<UInteractionMassDetectionProcessor> DetectionProcessor;
+
+  UPROPERTY(Transient)
+  TObjectPtr<UInteractionMassMarkerProcessor> MarkerProcessor;
+
+  TArray<FInteractionMassViewer> Viewers;
+  TArray<FInteractionMassMarker> VisibleMarkers;
+  FCriticalSection VisibleMarkersLock;
+
+  int32 NumInteractables = 0;
+  bool bHeadless = false;
+};
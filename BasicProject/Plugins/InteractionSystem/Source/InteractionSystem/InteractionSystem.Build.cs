@@ -18,11 +18,17 @@ public class InteractionSystem : ModuleRules
 			"UMG",
 			"Slate",
 			"SlateCore",
-			"DeveloperSettings"
+			"DeveloperSettings",
+			"GameplayTags",
+			"NetCore"
 		});
 
 		PrivateDependencyModuleNames.AddRange(new string[]
 		{
 		});
+
+		// Dedicated server builds compile the marker UI path out entirely
+		PublicDefinitions.Add("INTERACTION_WITH_MARKER_UI=" +
+			(Target.Type == TargetType.Server ? "0" : "1"));
 	}
 }
@@ -2,11 +2,50 @@
 
 #include "InteractableComponent.h"
 #include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetTree.h"
 #include "Components/WidgetComponent.h"
 #include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/PlayerController.h"
+#include "InteractableDefinition.h"
+#include "InteractionDetectorComponent.h"
+#include "InteractionInitQueueSubsystem.h"
+#include "InteractionProfiling.h"
+#include "InteractionRegistrySubsystem.h"
 #include "InteractionRouter.h"
 #include "InteractionSettings.h"
+#include "InteractionSystem.h"
+#include "Net/Core/PushModel/PushModel.h"
+#include "Net/UnrealNetwork.h"
+#include "Internationalization/TextLocalizationManager.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "InteractionTags.h"
 #include "InteractionWidget.h"
+#include "UObject/ObjectSaveContext.h"
+
+namespace InteractableComponent {
+/** Object size as reported by `obj list` (max containers + exclusive resources) */
+static int64 GetObjectBytes(UObject *Object) {
+  if (!Object) {
+    return 0;
+  }
+  FArchiveCountMem CountMem(Object);
+  return static_cast<int64>(CountMem.GetMax()) +
+         static_cast<int64>(
+             Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive));
+}
+
+/** Values used when there is neither a definition nor an override */
+static const FText &GetDefaultDisplayText() {
+  static const FText DefaultText =
+      NSLOCTEXT("Interaction", "DefaultText", "Interact");
+  return DefaultText;
+}
+static const FVector DefaultMarkerOffset(0.0f, 0.0f, 100.0f);
+
+/** Owner classes already warned about not replicating (one line per class) */
+static TSet<FName> WarnedUnreplicatedClasses;
+} // namespace InteractableComponent
 
 // Initialize static delegate
 FOnInteractionEvent UInteractableComponent::OnInteractionEvent;
@@ -14,16 +53,167 @@ FOnInteractionEvent UInteractableComponent::OnInteractionEvent;
 UInteractableComponent::UInteractableComponent() {
   PrimaryComponentTick.bCanEverTick = true;
   PrimaryComponentTick.TickInterval = 0.0f;
+  SetIsReplicatedByDefault(true);
+
+#if WITH_EDITORONLY_DATA
+  bOverride_InteractionType = false;
+  bOverride_DisplayText = false;
+  bOverride_MarkerOffset = false;
+  InteractionType = InteractionTags::Interaction_Default;
+#endif
+}
+
+void UInteractableComponent::PostLoad() {
+  Super::PostLoad();
+#if WITH_EDITORONLY_DATA
+  BakeOverrides();
+#endif
+}
+
+#if WITH_EDITOR
+void UInteractableComponent::PreSave(FObjectPreSaveContext SaveContext) {
+  BakeOverrides();
+  Super::PreSave(SaveContext);
+}
+
+void UInteractableComponent::PostEditChangeProperty(
+    FPropertyChangedEvent &PropertyChangedEvent) {
+  Super::PostEditChangeProperty(PropertyChangedEvent);
+  BakeOverrides();
+  InvalidateDisplayText();
+  ApplyMarkerOffset();
+}
+#endif
+
+#if WITH_EDITORONLY_DATA
+void UInteractableComponent::BakeOverrides() {
+  using namespace InteractableComponent;
+
+  // Without a definition, values left at the default need no override
+  FInteractableOverrides Baked;
+  Baked.bHasInteractionType =
+      bOverride_InteractionType ||
+      (!Definition && InteractionType != InteractionTags::Interaction_Default);
+  Baked.bHasDisplayText =
+      bOverride_DisplayText ||
+      (!Definition && !DisplayText.EqualTo(GetDefaultDisplayText()));
+  Baked.bHasMarkerOffset = bOverride_MarkerOffset ||
+                           (!Definition && MarkerOffset != DefaultMarkerOffset);
+  if (Baked.bHasInteractionType) {
+    Baked.InteractionType = InteractionType;
+  }
+  if (Baked.bHasDisplayText) {
+    Baked.DisplayText = DisplayText;
+  }
+  if (Baked.bHasMarkerOffset) {
+    Baked.MarkerOffset = MarkerOffset;
+  }
+
+  Overrides.Empty();
+  if (Baked.bHasInteractionType || Baked.bHasDisplayText ||
+      Baked.bHasMarkerOffset) {
+    Overrides.Add(MoveTemp(Baked));
+  }
+}
+#endif
+
+void UInteractableComponent::GetLifetimeReplicatedProps(
+    TArray<FLifetimeProperty> &OutLifetimeProps) const {
+  Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+  // Push model: properties are only compared after a setter marks them dirty
+  FDoRepLifetimeParams Params;
+  Params.bIsPushBased = true;
+  DOREPLIFETIME_WITH_PARAMS_FAST(UInteractableComponent, bCanInteract, Params);
+  DOREPLIFETIME_WITH_PARAMS_FAST(UInteractableComponent, Definition, Params);
+  DOREPLIFETIME_WITH_PARAMS_FAST(UInteractableComponent, Overrides, Params);
+
+  Params.Condition = COND_InitialOnly;
+  DOREPLIFETIME_WITH_PARAMS_FAST(UInteractableComponent, NetHandle, Params);
 }
 
 void UInteractableComponent::BeginPlay() {
   Super::BeginPlay();
 
-  // Get widget class from settings
-  TSubclassOf<UUserWidget> WidgetClass = nullptr;
-  if (const UInteractionSettings *Settings = UInteractionSettings::Get()) {
-    WidgetClass = Settings->DefaultWidgetClass.LoadSynchronous();
+  // Register for handle-based lookup; the server's handle reaches clients
+  // through the owner's initial replication. Level-placed actors report
+  // authority on clients until they replicate, so gate on the net mode.
+  if (UInteractionRegistrySubsystem *Registry =
+          GetWorld()->GetSubsystem<UInteractionRegistrySubsystem>()) {
+    AActor *Owner = GetOwner();
+    if (GetNetMode() != NM_Client) {
+      NetHandle = Registry->Register(this);
+      if (GetNetMode() == NM_Standalone) {
+        // No connections to replicate to
+      } else if (!Owner->GetIsReplicated()) {
+        // Replication is the owner's choice: without it clients never get a
+        // handle, so they only see it locally and cannot request it
+        bool bAlreadyWarned = false;
+        InteractableComponent::WarnedUnreplicatedClasses.Add(
+            Owner->GetClass()->GetFName(), &bAlreadyWarned);
+        if (!bAlreadyWarned) {
+          UE_LOG(LogInteractionSystem, Warning,
+                 TEXT("%s does not replicate: clients cannot interact with "
+                      "its interactables (enable bReplicates on the class)"),
+                 *Owner->GetClass()->GetName());
+        }
+      } else if (bAllowNetDormancy && Owner->NetDormancy == DORM_Awake) {
+        // Send the initial bunch to each connection, then sleep until a
+        // setter flushes dormancy
+        Owner->SetNetDormancy(DORM_DormantAll);
+      }
+    } else if (NetHandle.IsValid()) {
+      Registry->RegisterWithHandle(this, NetHandle);
+    } else if (!Owner->GetIsReplicated()) {
+      // Spawned locally on this client, or not replicated: no server handle
+      // will ever arrive, so take one from the local range
+      NetHandle = Registry->RegisterLocal(this);
+    }
+    // Otherwise OnRep_NetHandle registers once the server's handle arrives
+  }
+
+  // Servers only need registration for detection and validation: no widget
+  // class load, no widget component and no marker animation tick
+  bHeadless = UInteractionSettings::IsHeadless(GetWorld());
+  if (bHeadless) {
+    SetComponentTickEnabled(false);
+    return;
+  }
+
+  // Spread marker setup over frames, nearest to local players first
+  const UInteractionSettings *Settings = UInteractionSettings::Get();
+  UInteractionInitQueueSubsystem *InitQueue =
+      GetWorld()->GetSubsystem<UInteractionInitQueueSubsystem>();
+  if (InitQueue && Settings && Settings->MarkerInitBudgetMs > 0.0f) {
+    bMarkerQueued = true;
+    InitQueue->Enqueue(this);
+  } else {
+    CreateMarker();
+  }
+}
+
+void UInteractableComponent::CreateMarker() {
+  if (bMarkerCreated || bHeadless || !HasBegunPlay()) {
+    return;
+  }
+
+#if INTERACTION_WITH_MARKER_UI
+  // A queued marker waits for the queue's async class load (a class that
+  // failed to load leaves it without a marker); others load it here
+  const TSoftClassPtr<UUserWidget> &WidgetClassPath =
+      GetMarkerWidgetClassPath();
+  TSubclassOf<UUserWidget> WidgetClass = WidgetClassPath.Get();
+  if (!WidgetClass && !WidgetClassPath.IsNull()) {
+    if (bMarkerQueued) {
+      return;
+    }
+    WidgetClass = WidgetClassPath.LoadSynchronous();
   }
+#endif
+  bMarkerCreated = true;
+
+#if INTERACTION_WITH_MARKER_UI
+  LLM_SCOPE_BYTAG(Interaction_Markers);
 
   if (WidgetClass && GetOwner()) {
     // Create widget component
@@ -31,7 +221,7 @@ void UInteractableComponent::BeginPlay() {
         NewObject<UWidgetComponent>(GetOwner(), TEXT("InteractionMarker"));
     if (MarkerWidgetComponent) {
       MarkerWidgetComponent->SetupAttachment(GetOwner()->GetRootComponent());
-      MarkerWidgetComponent->SetRelativeLocation(MarkerOffset);
+      MarkerWidgetComponent->SetRelativeLocation(GetMarkerOffset());
       MarkerWidgetComponent->SetWidgetSpace(EWidgetSpace::Screen);
       MarkerWidgetComponent->SetDrawSize(FVector2D(200.0f, 100.0f));
       MarkerWidgetComponent->SetWidgetClass(WidgetClass);
@@ -47,10 +237,32 @@ void UInteractableComponent::BeginPlay() {
       }
     }
   }
+
+  // Viewers may have found this while its setup was queued
+  if (IsMarkerVisible()) {
+    ApplyViewerMasks(0, 0);
+  }
+#endif
+}
+
+const TSoftClassPtr<UUserWidget> &
+UInteractableComponent::GetMarkerWidgetClassPath() const {
+  if (Definition && !Definition->MarkerWidgetClass.IsNull()) {
+    return Definition->MarkerWidgetClass;
+  }
+  static const TSoftClassPtr<UUserWidget> NoWidgetClass;
+  const UInteractionSettings *Settings = UInteractionSettings::Get();
+  return Settings ? Settings->DefaultWidgetClass : NoWidgetClass;
 }
 
 void UInteractableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+  if (UInteractionRegistrySubsystem *Registry =
+          GetWorld()->GetSubsystem<UInteractionRegistrySubsystem>()) {
+    Registry->Unregister(this);
+  }
+
   if (MarkerWidgetComponent) {
+    ClearViewportHiding();
     MarkerWidgetComponent->DestroyComponent();
     MarkerWidgetComponent = nullptr;
   }
@@ -72,82 +284,302 @@ void UInteractableComponent::TryInteract(AActor *InteractionInstigator) {
     return;
   }
 
-  FInteractionEventData EventData = BuildEventData(InteractionInstigator);
+  FInteractionEvent Event = BuildEvent(InteractionInstigator);
 
   // Step 1: Try local handling if enabled
   if (bHandleLocally) {
-    OnInteractLocal.Broadcast(EventData);
+    // Blueprint-facing view is only built when someone listens
+    if (OnInteractLocal.IsBound()) {
+      OnInteractLocal.Broadcast(Event.ToEventData());
+    }
 
     if (GEngine) {
       GEngine->AddOnScreenDebugMessage(
           -1, 3.0f, FColor::Green,
-          FString::Printf(TEXT("[Local] %s: %s"), *InteractionType.ToString(),
-                          *DisplayText.ToString()));
+          FString::Printf(TEXT("[Local] %s: %s"),
+                          *GetInteractionType().ToString(),
+                          *GetDisplayText().ToString()));
     }
   }
 
   // Step 2: Route to global systems via Router if not handled locally
-  if (!EventData.bHandled) {
+  if (!Event.IsHandled()) {
     // Route through the global router (MainProject's subsystem)
-    FInteractionRouterRegistry::Route(EventData);
+    FInteractionRouterRegistry::Route(Event);
 
     // Also broadcast to static delegate for backwards compatibility
-    OnInteractionEvent.Broadcast(EventData);
+    if (OnInteractionEvent.IsBound()) {
+      FInteractionEventData EventData = Event.ToEventData();
+      OnInteractionEvent.Broadcast(EventData);
+      Event.SetHandled(EventData.bHandled);
+    }
 
-    if (!EventData.bHandled && GEngine) {
+    if (!Event.IsHandled() && GEngine) {
       GEngine->AddOnScreenDebugMessage(
           -1, 3.0f, FColor::Yellow,
           FString::Printf(TEXT("[Unhandled] %s: %s"),
-                          *InteractionType.ToString(),
-                          *DisplayText.ToString()));
+                          *GetInteractionType().ToString(),
+                          *GetDisplayText().ToString()));
     }
   }
 }
 
 void UInteractableComponent::SetCanInteract(bool bNewCanInteract) {
+  if (bCanInteract == bNewCanInteract) {
+    return;
+  }
+
+  FlushReplicatedState();
   bCanInteract = bNewCanInteract;
+  MARK_PROPERTY_DIRTY_FROM_NAME(UInteractableComponent, bCanInteract, this);
 }
 
-void UInteractableComponent::SetVisible(bool bNewVisible) {
-  if (bIsVisible == bNewVisible) {
-    return;
+FText UInteractableComponent::GetDisplayText() const {
+  const FInteractableOverrides *Instance = GetOverrides();
+  const FText &Pattern =
+      Instance && Instance->bHasDisplayText ? Instance->DisplayText
+      : Definition ? Definition->DisplayText
+                   : InteractableComponent::GetDefaultDisplayText();
+  FInteractableDisplayTextFormat *Format = DisplayTextFormat.Get();
+  if (!Format) {
+    return Pattern;
+  }
+
+  // Pattern is compared by identity, so direct assignments are caught too
+  const uint16 TextRevision = FTextLocalizationManager::Get().GetTextRevision();
+  if (!Format->Pattern.IdenticalTo(Pattern)) {
+    Format->Pattern = Pattern;
+    Format->Format = FTextFormat(Pattern);
+    Format->bDirty = true;
+  }
+  if (Format->bDirty || Format->TextRevision != TextRevision) {
+    Format->Text = FText::Format(Format->Format, Format->Arguments);
+    Format->TextRevision = TextRevision;
+    Format->bDirty = false;
   }
+  return Format->Text;
+}
 
-  bIsVisible = bNewVisible;
+void UInteractableComponent::SetDisplayTextArgument(FName ArgumentName,
+                                                    const FText &Value) {
+  SetDisplayTextArgumentValue(ArgumentName, FFormatArgumentValue(Value));
+}
 
-  if (bNewVisible) {
-    // Start fade in animation
-    TargetMarkerOpacity = 1.0f;
-    TargetMarkerScale = 1.0f;
-    bIsAnimating = true;
+void UInteractableComponent::SetDisplayTextArgumentInt(FName ArgumentName,
+                                                       int32 Value) {
+  SetDisplayTextArgumentValue(ArgumentName, FFormatArgumentValue(Value));
+}
 
-    if (MarkerWidgetComponent) {
-      MarkerWidgetComponent->SetVisibility(true);
+void UInteractableComponent::SetDisplayTextArgumentValue(
+    FName ArgumentName, FFormatArgumentValue &&Value) {
+  if (!DisplayTextFormat) {
+    DisplayTextFormat = MakeUnique<FInteractableDisplayTextFormat>();
+  }
+
+  const FString Key = ArgumentName.ToString();
+  if (const FFormatArgumentValue *Existing =
+          DisplayTextFormat->Arguments.Find(Key)) {
+    // Callers often build the same text fresh on every call, so texts are
+    // compared by content rather than identity
+    const bool bUnchanged =
+        Existing->GetType() == EFormatArgumentType::Text &&
+                Value.GetType() == EFormatArgumentType::Text
+            ? Existing->GetTextValue().EqualTo(Value.GetTextValue())
+            : Existing->IdenticalTo(Value, ETextIdenticalModeFlags::None);
+    if (bUnchanged) {
+      return;
     }
-  } else {
-    // Start fade out animation
-    TargetMarkerOpacity = 0.0f;
-    TargetMarkerScale = 0.0f;
-    bIsAnimating = true;
+  }
 
-    // Also hide text panel immediately when leaving visibility
-    bIsInteractable = false;
+  DisplayTextFormat->Arguments.Add(Key, MoveTemp(Value));
+  InvalidateDisplayText();
+}
+
+void UInteractableComponent::InvalidateDisplayText() {
+  if (DisplayTextFormat) {
+    DisplayTextFormat->bDirty = true;
+  }
+  ++DisplayTextSerial;
+}
+
+void UInteractableComponent::OnRep_Overrides() {
+  InvalidateDisplayText();
+  ApplyMarkerOffset();
+}
+
+void UInteractableComponent::ApplyMarkerOffset() {
+  if (MarkerWidgetComponent) {
+    MarkerWidgetComponent->SetRelativeLocation(GetMarkerOffset());
+  }
+}
+
+FGameplayTag UInteractableComponent::GetInteractionType() const {
+  const FInteractableOverrides *Instance = GetOverrides();
+  if (Instance && Instance->bHasInteractionType) {
+    return Instance->InteractionType;
   }
+  return Definition ? Definition->InteractionType
+                    : InteractionTags::Interaction_Default;
 }
 
-void UInteractableComponent::SetInteractable(bool bNewInteractable) {
-  if (bIsInteractable == bNewInteractable) {
+FVector UInteractableComponent::GetMarkerOffset() const {
+  const FInteractableOverrides *Instance = GetOverrides();
+  if (Instance && Instance->bHasMarkerOffset) {
+    return Instance->MarkerOffset;
+  }
+  return Definition ? Definition->MarkerOffset
+                    : InteractableComponent::DefaultMarkerOffset;
+}
+
+void UInteractableComponent::SetDefinition(
+    const UInteractableDefinition *NewDefinition) {
+  if (Definition == NewDefinition) {
     return;
   }
 
-  bIsInteractable = bNewInteractable;
+  FlushReplicatedState();
+  Definition = NewDefinition;
+  MARK_PROPERTY_DIRTY_FROM_NAME(UInteractableComponent, Definition, this);
+  InvalidateDisplayText();
+  ApplyMarkerOffset();
+
+  // A queued marker may now need another widget class loaded first
+  if (bMarkerQueued && !bMarkerCreated && HasBegunPlay()) {
+    if (UInteractionInitQueueSubsystem *InitQueue =
+            GetWorld()->GetSubsystem<UInteractionInitQueueSubsystem>()) {
+      InitQueue->Enqueue(this);
+    }
+  }
+}
 
-  // Update widget text panel visibility
-  if (MarkerWidgetComponent) {
+void UInteractableComponent::SetDisplayText(const FText &NewDisplayText) {
+  const FInteractableOverrides *Instance = GetOverrides();
+  if (Instance && Instance->bHasDisplayText &&
+      Instance->DisplayText.IdenticalTo(NewDisplayText)) {
+    return;
+  }
+
+  FlushReplicatedState();
+  FInteractableOverrides &Mutable = GetOrAddOverrides();
+  Mutable.bHasDisplayText = true;
+  Mutable.DisplayText = NewDisplayText;
+#if WITH_EDITORONLY_DATA
+  bOverride_DisplayText = true;
+  DisplayText = NewDisplayText;
+#endif
+  MARK_PROPERTY_DIRTY_FROM_NAME(UInteractableComponent, Overrides, this);
+  InvalidateDisplayText();
+}
+
+void UInteractableComponent::SetInteractionType(
+    FGameplayTag NewInteractionType) {
+  const FInteractableOverrides *Instance = GetOverrides();
+  if (Instance && Instance->bHasInteractionType &&
+      Instance->InteractionType == NewInteractionType) {
+    return;
+  }
+
+  FlushReplicatedState();
+  FInteractableOverrides &Mutable = GetOrAddOverrides();
+  Mutable.bHasInteractionType = true;
+  Mutable.InteractionType = NewInteractionType;
+#if WITH_EDITORONLY_DATA
+  bOverride_InteractionType = true;
+  InteractionType = NewInteractionType;
+#endif
+  MARK_PROPERTY_DIRTY_FROM_NAME(UInteractableComponent, Overrides, this);
+}
+
+void UInteractableComponent::SetMarkerOffset(const FVector &NewMarkerOffset) {
+  const FInteractableOverrides *Instance = GetOverrides();
+  if (Instance && Instance->bHasMarkerOffset &&
+      Instance->MarkerOffset == NewMarkerOffset) {
+    return;
+  }
+
+  FlushReplicatedState();
+  FInteractableOverrides &Mutable = GetOrAddOverrides();
+  Mutable.bHasMarkerOffset = true;
+  Mutable.MarkerOffset = NewMarkerOffset;
+#if WITH_EDITORONLY_DATA
+  bOverride_MarkerOffset = true;
+  MarkerOffset = NewMarkerOffset;
+#endif
+  MARK_PROPERTY_DIRTY_FROM_NAME(UInteractableComponent, Overrides, this);
+  ApplyMarkerOffset();
+}
+
+void UInteractableComponent::FlushReplicatedState() {
+  AActor *Owner = GetOwner();
+  if (Owner && Owner->HasAuthority() && Owner->NetDormancy > DORM_Awake) {
+    Owner->FlushNetDormancy();
+  }
+}
+
+void UInteractableComponent::SetVisible(int32 ViewerIndex, bool bNewVisible) {
+  if (bHeadless || ViewerIndex < 0 || ViewerIndex >= 32) {
+    return;
+  }
+
+  const uint32 ViewerBit = 1u << ViewerIndex;
+  const uint32 OldVisibleViewers = VisibleViewers;
+  const uint32 OldTargetViewers = TargetViewers;
+  if (bNewVisible) {
+    VisibleViewers |= ViewerBit;
+  } else {
+    // Leaving visibility also ends this viewer's targeting
+    VisibleViewers &= ~ViewerBit;
+    TargetViewers &= ~ViewerBit;
+  }
+  ApplyViewerMasks(OldVisibleViewers, OldTargetViewers);
+}
+
+void UInteractableComponent::SetInteractable(int32 ViewerIndex,
+                                             bool bNewInteractable) {
+  if (bHeadless || ViewerIndex < 0 || ViewerIndex >= 32) {
+    return;
+  }
+
+  const uint32 ViewerBit = 1u << ViewerIndex;
+  const uint32 OldTargetViewers = TargetViewers;
+  if (bNewInteractable) {
+    TargetViewers |= ViewerBit & VisibleViewers;
+  } else {
+    TargetViewers &= ~ViewerBit;
+  }
+  ApplyViewerMasks(VisibleViewers, OldTargetViewers);
+}
+
+void UInteractableComponent::ApplyViewerMasks(uint32 OldVisibleViewers,
+                                              uint32 OldTargetViewers) {
+  const bool bWasVisible = OldVisibleViewers != 0;
+  const bool bVisible = VisibleViewers != 0;
+  if (bVisible != bWasVisible) {
+    // Fade in, or fade out (text panel goes with the marker)
+    MarkerAnimation.SetShown(bVisible);
+    bIsAnimating = true;
+
+    if (bVisible) {
+      // A queued marker is shown once CreateMarker has run
+      if (bMarkerCreated) {
+        PrepareMarker();
+      }
+      bMarkerShown = true;
+      if (MarkerWidgetComponent) {
+        MarkerWidgetComponent->SetVisibility(true);
+      }
+    }
+  }
+
+  // Update widget text panel visibility; a marker fading out keeps its panel
+  const bool bWasTarget = OldTargetViewers != 0;
+  const bool bTarget = TargetViewers != 0;
+  if (bTarget != bWasTarget && (bTarget || bVisible) &&
+      MarkerWidgetComponent) {
     if (UUserWidget *Widget = MarkerWidgetComponent->GetWidget()) {
       if (UInteractionWidget *InteractionWidget =
               Cast<UInteractionWidget>(Widget)) {
-        if (bNewInteractable) {
+        if (bTarget) {
           InteractionWidget->ShowTextPanel();
         } else {
           InteractionWidget->HideTextPanelImmediate();
@@ -155,13 +587,104 @@ void UInteractableComponent::SetInteractable(bool bNewInteractable) {
       }
     }
   }
+
+  if (VisibleViewers != OldVisibleViewers) {
+    UpdateViewportHiding();
+  }
+}
+
+bool UInteractableComponent::PrepareMarker() {
+  if (bMarkerPrepared || bHeadless) {
+    return false;
+  }
+
+  // Still queued: set it up now (CreateMarker prepares it if already visible)
+  CreateMarker();
+  if (bMarkerPrepared) {
+    return true;
+  }
+  bMarkerPrepared = true;
+
+#if INTERACTION_WITH_MARKER_UI
+  LLM_SCOPE_BYTAG(Interaction_Markers);
+  UInteractionWidget *InteractionWidget =
+      MarkerWidgetComponent
+          ? Cast<UInteractionWidget>(MarkerWidgetComponent->GetWidget())
+          : nullptr;
+  if (InteractionWidget) {
+    InteractionWidget->PrepareForDisplay();
+    return true;
+  }
+#endif
+  return false;
+}
+
+void UInteractableComponent::UpdateViewportHiding() {
+  const UGameInstance *GameInstance =
+      GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+  if (!MarkerWidgetComponent || !GameInstance ||
+      GameInstance->GetNumLocalPlayers() < 2) {
+    return;
+  }
+
+  const UInteractionRegistrySubsystem *Registry =
+      GetWorld()->GetSubsystem<UInteractionRegistrySubsystem>();
+  if (!Registry) {
+    return;
+  }
+
+  for (int32 ViewerIndex = 0;
+       ViewerIndex < UInteractionRegistrySubsystem::MaxViewers; ++ViewerIndex) {
+    const UInteractionDetectorComponent *Viewer =
+        Registry->GetViewer(ViewerIndex);
+    APlayerController *PC = Viewer ? Viewer->GetLocalViewer() : nullptr;
+    if (!PC) {
+      continue;
+    }
+
+    const TWeakObjectPtr<UPrimitiveComponent> Marker = MarkerWidgetComponent;
+    if (IsVisibleTo(ViewerIndex)) {
+      PC->HiddenPrimitiveComponents.RemoveSingleSwap(Marker,
+                                                     EAllowShrinking::No);
+    } else {
+      PC->HiddenPrimitiveComponents.AddUnique(Marker);
+    }
+  }
+}
+
+void UInteractableComponent::ClearViewportHiding() {
+  const TWeakObjectPtr<UPrimitiveComponent> Marker = MarkerWidgetComponent;
+  for (FConstPlayerControllerIterator It =
+           GetWorld()->GetPlayerControllerIterator();
+       It; ++It) {
+    APlayerController *PC = It->Get();
+    if (PC && PC->IsLocalController()) {
+      PC->HiddenPrimitiveComponents.RemoveSingleSwap(Marker,
+                                                     EAllowShrinking::No);
+    }
+  }
+}
+
+void UInteractableComponent::BeginPredictedUse(AActor *InteractionInstigator) {
+  ++PredictedUseCount;
+  OnInteractPredicted.Broadcast(InteractionInstigator);
+}
+
+void UInteractableComponent::EndPredictedUse(EInteractionResultCode Code) {
+  PredictedUseCount = FMath::Max(0, PredictedUseCount - 1);
+  if (Code != EInteractionResultCode::Accepted) {
+    OnPredictionRolledBack.Broadcast(Code);
+  }
 }
 
 void UInteractableComponent::UpdateMarkerAnimation(float DeltaTime) {
+  INTERACTION_SCOPE_CYCLE_COUNTER(STAT_InteractionMarkerAnimation);
+
   if (!MarkerWidgetComponent) {
     bIsAnimating = false;
     return;
   }
+  INC_DWORD_STAT(STAT_InteractionAnimatingMarkers);
 
   // Get animation settings
   float FadeDuration = 0.3f;
@@ -171,68 +694,80 @@ void UInteractableComponent::UpdateMarkerAnimation(float DeltaTime) {
     Elasticity = Settings->DefaultAnimationElasticity;
   }
 
-  // Spring parameters
-  const float SpringStiffness = 300.0f;
-  const float Damping = 15.0f + (10.0f - Elasticity) * 2.0f;
-
-  // Scale animation (elastic)
-  const float ScaleDisplacement = TargetMarkerScale - CurrentMarkerScale;
-  const float SpringForce = ScaleDisplacement * SpringStiffness;
-  const float DampingForce = -MarkerScaleVelocity * Damping;
-  const float Acceleration = SpringForce + DampingForce;
-
-  MarkerScaleVelocity += Acceleration * DeltaTime;
-  CurrentMarkerScale += MarkerScaleVelocity * DeltaTime;
-  CurrentMarkerScale = FMath::Max(0.0f, CurrentMarkerScale);
-
-  // Opacity animation (linear)
-  const float FadeSpeed = FadeDuration > 0.0f ? 1.0f / FadeDuration : 100.0f;
-  if (CurrentMarkerOpacity < TargetMarkerOpacity) {
-    CurrentMarkerOpacity = FMath::Min(
-        CurrentMarkerOpacity + FadeSpeed * DeltaTime, TargetMarkerOpacity);
-  } else if (CurrentMarkerOpacity > TargetMarkerOpacity) {
-    CurrentMarkerOpacity = FMath::Max(
-        CurrentMarkerOpacity - FadeSpeed * DeltaTime, TargetMarkerOpacity);
-  }
+  const bool bSettled =
+      MarkerAnimation.Step(DeltaTime, FadeDuration, Elasticity);
 
   // Apply to marker elements via InteractionWidget
   if (UUserWidget *Widget = MarkerWidgetComponent->GetWidget()) {
     if (UInteractionWidget *InteractionWidget =
             Cast<UInteractionWidget>(Widget)) {
-      InteractionWidget->SetMarkerOpacity(CurrentMarkerOpacity);
-      InteractionWidget->SetMarkerScale(CurrentMarkerScale);
+      InteractionWidget->SetMarkerOpacity(MarkerAnimation.Opacity);
+      InteractionWidget->SetMarkerScale(MarkerAnimation.Scale);
     }
   }
 
-  // Check if animation complete
-  const bool bScaleSettled =
-      FMath::IsNearlyEqual(CurrentMarkerScale, TargetMarkerScale, 0.01f) &&
-      FMath::Abs(MarkerScaleVelocity) < 0.1f;
-  const bool bOpacitySettled =
-      FMath::IsNearlyEqual(CurrentMarkerOpacity, TargetMarkerOpacity, 0.01f);
-
-  if (bScaleSettled && bOpacitySettled) {
-    CurrentMarkerScale = TargetMarkerScale;
-    CurrentMarkerOpacity = TargetMarkerOpacity;
-    MarkerScaleVelocity = 0.0f;
+  if (bSettled) {
     bIsAnimating = false;
 
     // Hide completely when faded out
-    if (TargetMarkerScale == 0.0f && TargetMarkerOpacity == 0.0f) {
+    if (MarkerAnimation.IsHiding()) {
       MarkerWidgetComponent->SetVisibility(false);
     }
   }
 }
 
-FInteractionEventData
-UInteractableComponent::BuildEventData(AActor *InteractionInstigator) const {
-  FInteractionEventData EventData;
-  EventData.Instigator = InteractionInstigator;
-  EventData.TargetActor = GetOwner();
-  EventData.TargetComponent = const_cast<UInteractableComponent *>(this);
-  EventData.InteractionType = InteractionType;
-  EventData.DisplayText = DisplayText;
-  EventData.bHandled = false;
+void UInteractableComponent::AccumulateMemoryFootprint(
+    FInteractableMemoryFootprint &OutFootprint) const {
+  using InteractableComponent::GetObjectBytes;
+
+  UInteractableComponent *MutableThis =
+      const_cast<UInteractableComponent *>(this);
+  OutFootprint.ComponentBytes += GetObjectBytes(MutableThis);
+
+  if (!MarkerWidgetComponent) {
+    return;
+  }
+  OutFootprint.MarkerComponentBytes += GetObjectBytes(MarkerWidgetComponent);
+
+  UUserWidget *Widget = MarkerWidgetComponent->GetWidget();
+  if (!Widget) {
+    return;
+  }
+  OutFootprint.WidgetBytes += GetObjectBytes(Widget);
+  OutFootprint.NumWidgets++;
+  OutFootprint.NumSlateWidgets += Widget->GetCachedWidget().IsValid() ? 1 : 0;
+
+  if (Widget->WidgetTree) {
+    OutFootprint.WidgetBytes += GetObjectBytes(Widget->WidgetTree);
+    Widget->WidgetTree->ForEachWidget([&OutFootprint](UWidget *Child) {
+      OutFootprint.WidgetBytes += GetObjectBytes(Child);
+      OutFootprint.NumWidgets++;
+      OutFootprint.NumSlateWidgets += Child->GetCachedWidget().IsValid() ? 1 : 0;
+    });
+  }
+}
+
+void UInteractableComponent::OnRep_NetHandle(
+    FInteractableHandle PreviousHandle) {
+  // Before BeginPlay the handle is picked up there instead
+  if (HasBegunPlay()) {
+    if (UInteractionRegistrySubsystem *Registry =
+            GetWorld()->GetSubsystem<UInteractionRegistrySubsystem>()) {
+      Registry->RegisterWithHandle(this, NetHandle, PreviousHandle);
+    }
+  }
+}
+
+FInteractionTypeId UInteractableComponent::GetInteractionTypeId() const {
+  const FGameplayTag Type = GetInteractionType();
+  if (CachedTypeTag != Type || CachedTypeId == 0) {
+    CachedTypeTag = Type;
+    CachedTypeId = FInteractionTypeRegistry::GetId(Type);
+  }
+  return CachedTypeId;
+}
 
-  return EventData;
+FInteractionEvent
+UInteractableComponent::BuildEvent(AActor *InteractionInstigator) const {
+  return FInteractionEvent::Make(this, InteractionInstigator);
 }
@@ -0,0 +1,199 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "InteractableIndexActor.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+#include "Components/BillboardComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "InteractableComponent.h"
+#include "InteractionProfiling.h"
+#include "InteractionRegistrySubsystem.h"
+#include "InteractionSystem.h"
+#include "UObject/ObjectSaveContext.h"
+
+AInteractableIndexActor::AInteractableIndexActor() {
+  // Entries are relative to this root, which level transforms move
+  USceneComponent *SceneRoot =
+      CreateDefaultSubobject<USceneComponent>(TEXT("SceneRoot"));
+  SceneRoot->SetMobility(EComponentMobility::Static);
+  RootComponent = SceneRoot;
+#if WITH_EDITORONLY_DATA
+  if (UBillboardComponent *Sprite = GetSpriteComponent()) {
+    Sprite->SetupAttachment(SceneRoot);
+  }
+#endif
+}
+
+void AInteractableIndexActor::PostInitializeComponents() {
+  Super::PostInitializeComponents();
+
+  // Runs while the level is added to the world, before any actor begins play
+  UWorld *World = GetWorld();
+  if (World && World->IsGameWorld()) {
+    if (UInteractionRegistrySubsystem *Registry =
+            World->GetSubsystem<UInteractionRegistrySubsystem>()) {
+      Registry->AddBakedIndex(this);
+    }
+  }
+}
+
+void AInteractableIndexActor::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+  if (UInteractionRegistrySubsystem *Registry =
+          GetWorld()->GetSubsystem<UInteractionRegistrySubsystem>()) {
+    Registry->RemoveBakedIndex(this);
+  }
+  Super::EndPlay(EndPlayReason);
+}
+
+#if WITH_EDITOR
+void AInteractableIndexActor::PreSave(FObjectPreSaveContext ObjectSaveContext) {
+  Super::PreSave(ObjectSaveContext);
+
+  // Editor saves and cooking both pass through here
+  RebuildIndex();
+}
+
+void AInteractableIndexActor::RebuildIndex() {
+  const ULevel *Level = GetLevel();
+  if (!Level) {
+    return;
+  }
+
+  struct FBakedEntry {
+    uint64 Key = 0;
+    FInteractableIndexEntry Entry;
+  };
+
+  const FTransform IndexTransform = GetActorTransform();
+  TArray<FBakedEntry> Baked;
+  TInlineComponentArray<UInteractableComponent *> Interactables;
+  for (AActor *Actor : Level->Actors) {
+    if (Actor == this || !IsIndexable(Actor)) {
+      continue;
+    }
+
+    const FVector Location =
+        IndexTransform.InverseTransformPosition(Actor->GetActorLocation());
+    const uint64 Key = GetCellKey(Location);
+
+    Actor->GetComponents(Interactables);
+    for (UInteractableComponent *Interactable : Interactables) {
+      FBakedEntry &Bake = Baked.AddDefaulted_GetRef();
+      Bake.Key = Key;
+      Bake.Entry.Location = FVector3f(Location);
+      Bake.Entry.Definition = Interactable->GetDefinition();
+      Bake.Entry.Component = Interactable;
+    }
+  }
+
+  Algo::StableSortBy(Baked, &FBakedEntry::Key);
+
+  Entries.Reset(Baked.Num());
+  Cells.Reset();
+  for (FBakedEntry &Bake : Baked) {
+    if (Cells.IsEmpty() || Cells.Last().Key != Bake.Key) {
+      FInteractableIndexCell &Cell = Cells.AddDefaulted_GetRef();
+      Cell.Key = Bake.Key;
+      Cell.FirstEntry = Entries.Num();
+    }
+    Cells.Last().NumEntries++;
+    Entries.Add(MoveTemp(Bake.Entry));
+  }
+  Entries.Shrink();
+  Cells.Shrink();
+
+  UE_LOG(LogInteractionSystem, Log,
+         TEXT("%s: indexed %d static interactables in %d cells"),
+         *GetPathName(), Entries.Num(), Cells.Num());
+}
+
+void AInteractableIndexActor::EnsureLevelIndex(ULevel *Level) {
+  UWorld *World = Level ? Level->OwningWorld.Get() : nullptr;
+  if (!World || World->IsGameWorld() || World->IsPartitionedWorld()) {
+    return;
+  }
+
+  bool bHasInteractables = false;
+  for (AActor *Actor : Level->Actors) {
+    if (Cast<AInteractableIndexActor>(Actor)) {
+      return;
+    }
+    bHasInteractables =
+        bHasInteractables ||
+        (IsIndexable(Actor) &&
+         Actor->FindComponentByClass<UInteractableComponent>());
+  }
+  if (!bHasInteractables) {
+    return;
+  }
+
+  FActorSpawnParameters SpawnParams;
+  SpawnParams.OverrideLevel = Level;
+  SpawnParams.ObjectFlags |= RF_Transactional;
+  if (AInteractableIndexActor *Index =
+          World->SpawnActor<AInteractableIndexActor>(SpawnParams)) {
+    // Spawned after the level's objects were routed through PreSave
+    Index->RebuildIndex();
+  }
+}
+#endif
+
+bool AInteractableIndexActor::IsIndexable(const AActor *Actor) {
+  // Movable roots leave their cell; the registry scans them unindexed
+  const USceneComponent *Root = Actor ? Actor->GetRootComponent() : nullptr;
+  return Root && Root->Mobility != EComponentMobility::Movable;
+}
+
+void AInteractableIndexActor::QueryLocal(
+    const FVector &Origin, float Radius,
+    TFunctionRef<void(int32 EntryIndex)> Visit) const {
+  if (Cells.IsEmpty()) {
+    return;
+  }
+
+  const FVector3f Origin3f(Origin);
+  const float RadiusSq = FMath::Square(Radius);
+  const int32 MinX = FMath::FloorToInt32((Origin.X - Radius) / CellSize);
+  const int32 MaxX = FMath::FloorToInt32((Origin.X + Radius) / CellSize);
+  const int32 MinY = FMath::FloorToInt32((Origin.Y - Radius) / CellSize);
+  const int32 MaxY = FMath::FloorToInt32((Origin.Y + Radius) / CellSize);
+
+  for (int32 CellX = MinX; CellX <= MaxX; ++CellX) {
+    // A column's cells are contiguous and sorted by Y: one search per column
+    const uint64 MaxKey = GetCellKey(CellX, MaxY);
+    for (int32 CellIndex = Algo::LowerBoundBy(Cells, GetCellKey(CellX, MinY),
+                                              &FInteractableIndexCell::Key);
+         CellIndex < Cells.Num() && Cells[CellIndex].Key <= MaxKey;
+         ++CellIndex) {
+      const FInteractableIndexCell &Cell = Cells[CellIndex];
+      for (int32 i = Cell.FirstEntry; i < Cell.FirstEntry + Cell.NumEntries;
+           ++i) {
+        if (FVector3f::DistSquared(Entries[i].Location, Origin3f) <=
+            RadiusSq) {
+          Visit(i);
+        }
+      }
+    }
+  }
+}
+
+int32 AInteractableIndexActor::FindEntry(
+    const FVector &Location, const UInteractableComponent *Interactable) const {
+  const uint64 Key = GetCellKey(Location);
+  const int32 CellIndex =
+      Algo::BinarySearchBy(Cells, Key, &FInteractableIndexCell::Key);
+  if (CellIndex == INDEX_NONE) {
+    return INDEX_NONE;
+  }
+
+  // A cell holds a handful of entries; their soft paths resolve once loaded
+  const FInteractableIndexCell &Cell = Cells[CellIndex];
+  for (int32 i = Cell.FirstEntry; i < Cell.FirstEntry + Cell.NumEntries; ++i) {
+    if (Entries[i].Component.Get() == Interactable) {
+      return i;
+    }
+  }
+  return INDEX_NONE;
+}
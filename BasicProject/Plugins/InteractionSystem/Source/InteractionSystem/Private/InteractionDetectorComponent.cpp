@@ -3,13 +3,85 @@
 #include "InteractionDetectorComponent.h"
 #include "DrawDebugHelpers.h"
 #include "Engine/World.h"
-#include "EngineUtils.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
 #include "InteractableComponent.h"
+#include "InteractableDefinition.h"
+#include "InteractionMath.h"
+#include "InteractionRegistrySubsystem.h"
+#include "InteractionRouter.h"
+#include "InteractionProfiling.h"
 #include "InteractionSettings.h"
+#include "InteractionSystem.h"
+
+namespace InteractionDetectorComponent {
+/** Call Visit for the detector of each local player's pawn */
+template <typename FunctorType>
+static void ForEachLocalDetector(UWorld *World, FunctorType &&Visit) {
+  if (!World) {
+    return;
+  }
+  for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator();
+       It; ++It) {
+    const APlayerController *PC = It->Get();
+    const APawn *Pawn =
+        PC && PC->IsLocalController() ? PC->GetPawn() : nullptr;
+    const UInteractionDetectorComponent *Detector =
+        Pawn ? Pawn->FindComponentByClass<UInteractionDetectorComponent>()
+             : nullptr;
+    if (Detector) {
+      Visit(*Pawn, *Detector);
+    }
+  }
+}
+
+static FAutoConsoleCommandWithWorldAndArgs PredictionStatsCommand(
+    TEXT("Interaction.PredictionStats"),
+    TEXT("Log client prediction counters and the perceived latency saved for "
+         "each local player's detector."),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+        [](const TArray<FString> &Args, UWorld *World) {
+          ForEachLocalDetector(World, [](const APawn &Pawn,
+                                         const UInteractionDetectorComponent
+                                             &Detector) {
+            const FInteractionPredictionStats Stats =
+                Detector.GetPredictionStats();
+            UE_LOG(LogInteractionSystem, Display,
+                   TEXT("%s: predicted %d, confirmed %d, rolled back %d, "
+                        "timed out %d, latency saved avg %.1f ms max %.1f "
+                        "ms"),
+                   *Pawn.GetName(), Stats.NumPredicted, Stats.NumConfirmed,
+                   Stats.NumRolledBack, Stats.NumTimedOut,
+                   Stats.GetAverageLatencySavedSeconds() * 1000.0f,
+                   Stats.MaxLatencySavedSeconds * 1000.0f);
+          });
+        }));
+
+static FAutoConsoleCommandWithWorldAndArgs PrefetchStatsCommand(
+    TEXT("Interaction.PrefetchStats"),
+    TEXT("Log marker prefetch counters and the hit rate for each local "
+         "player's detector."),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+        [](const TArray<FString> &Args, UWorld *World) {
+          ForEachLocalDetector(World, [](const APawn &Pawn,
+                                         const UInteractionDetectorComponent
+                                             &Detector) {
+            const FInteractionPrefetchStats Stats = Detector.GetPrefetchStats();
+            UE_LOG(LogInteractionSystem, Display,
+                   TEXT("%s: prefetched %d, hits %d, misses %d, hit rate "
+                        "%.1f%%"),
+                   *Pawn.GetName(), Stats.NumPrefetched, Stats.NumHits,
+                   Stats.NumMisses, Stats.GetHitRate() * 100.0f);
+          });
+        }));
+} // namespace InteractionDetectorComponent
 
 UInteractionDetectorComponent::UInteractionDetectorComponent() {
   PrimaryComponentTick.bCanEverTick = true;
   PrimaryComponentTick.TickInterval = 0.0f;
+  SetIsReplicatedByDefault(true);
 
   // Load defaults from settings
   if (const UInteractionSettings *Settings = UInteractionSettings::Get()) {
@@ -18,7 +90,91 @@ UInteractionDetectorComponent::UInteractionDetectorComponent() {
   }
 }
 
-void UInteractionDetectorComponent::BeginPlay() { Super::BeginPlay(); }
+void UInteractionDetectorComponent::BeginPlay() {
+  LLM_SCOPE_BYTAG(Interaction_Detection);
+  Super::BeginPlay();
+  CompiledTypeFilter.SetQuery(TypeFilter);
+  bHeadless = UInteractionSettings::IsHeadless(GetWorld());
+
+  if (const UInteractionSettings *Settings = UInteractionSettings::Get()) {
+    RequestTokens = Settings->RequestBurst;
+  }
+  LastTokenRefillTime = GetWorld()->GetTimeSeconds();
+
+  if (UInteractionRegistrySubsystem *Registry =
+          GetWorld()->GetSubsystem<UInteractionRegistrySubsystem>()) {
+    Registry->RegisterDetector(this);
+  }
+
+  // The viewer bit follows possession (a client learns its controller late)
+  if (APawn *Pawn = Cast<APawn>(GetOwner())) {
+    Pawn->ReceiveControllerChangedDelegate.AddUniqueDynamic(
+        this, &UInteractionDetectorComponent::HandleControllerChanged);
+  }
+  UpdateViewerIndex();
+}
+
+void UInteractionDetectorComponent::HandleControllerChanged(
+    APawn *Pawn, AController *OldController, AController *NewController) {
+  UpdateViewerIndex();
+}
+
+void UInteractionDetectorComponent::UpdateViewerIndex() {
+  // Same rule as the Mass viewers' bPresentation: markers are for local players
+  const bool bWantsViewer = !bHeadless && GetLocalViewer() != nullptr;
+  if (bWantsViewer == (ViewerIndex != INDEX_NONE)) {
+    return;
+  }
+
+  if (!bWantsViewer) {
+    ReleaseViewerIndex();
+    return;
+  }
+
+  if (UInteractionRegistrySubsystem *Registry =
+          GetWorld()->GetSubsystem<UInteractionRegistrySubsystem>()) {
+    ViewerIndex = Registry->AcquireViewerIndex(this);
+    UE_CLOG(ViewerIndex == INDEX_NONE, LogInteractionSystem, Warning,
+            TEXT("%s: more than %d local marker-driving detectors, %s will "
+                 "not show markers"),
+            *GetNameSafe(GetWorld()),
+            UInteractionRegistrySubsystem::MaxViewers,
+            *GetNameSafe(GetOwner()));
+  }
+  if (ViewerIndex != INDEX_NONE) {
+    // Show markers now; a kept target was set before this viewer had a bit,
+    // and a tracked visible set has no bits for it yet
+    VisibleInteractables.Reset();
+    UpdateInteractables();
+    if (CurrentTarget) {
+      CurrentTarget->SetInteractable(ViewerIndex, true);
+    }
+  }
+}
+
+void UInteractionDetectorComponent::ReleaseViewerIndex() {
+  if (ViewerIndex == INDEX_NONE) {
+    return;
+  }
+
+  // Clear this viewer's bits on all visible interactables
+  for (UInteractableComponent *Interactable : VisibleInteractables) {
+    if (Interactable) {
+      Interactable->SetVisible(ViewerIndex, false);
+      Interactable->SetInteractable(ViewerIndex, false);
+    }
+  }
+  if (CurrentTarget) {
+    CurrentTarget->SetInteractable(ViewerIndex, false);
+  }
+  VisibleInteractables.Empty();
+
+  if (UInteractionRegistrySubsystem *Registry =
+          GetWorld()->GetSubsystem<UInteractionRegistrySubsystem>()) {
+    Registry->ReleaseViewerIndex(ViewerIndex);
+  }
+  ViewerIndex = INDEX_NONE;
+}
 
 void UInteractionDetectorComponent::TickComponent(
     float DeltaTime, ELevelTick TickType,
@@ -32,8 +188,11 @@ void UInteractionDetectorComponent::TickComponent(
     UpdateInteractables();
   }
 
+  FlushPendingResults(false);
+  ExpirePredictions();
+
   // Draw debug circles
-  if (bDrawDebug && GetOwner()) {
+  if (bDrawDebug && !bHeadless && GetOwner()) {
     const FVector Location = GetOwner()->GetActorLocation();
     // Visibility radius (green)
     DrawDebugCircle(GetWorld(), Location, VisibilityRadius, 64, FColor::Green,
@@ -48,30 +207,275 @@ void UInteractionDetectorComponent::TickComponent(
 
 void UInteractionDetectorComponent::EndPlay(
     const EEndPlayReason::Type EndPlayReason) {
-  // Clear all visible interactables
-  for (UInteractableComponent *Interactable : VisibleInteractables) {
-    if (Interactable) {
-      Interactable->SetVisible(false);
-      Interactable->SetInteractable(false);
-    }
+  if (APawn *Pawn = Cast<APawn>(GetOwner())) {
+    Pawn->ReceiveControllerChangedDelegate.RemoveDynamic(
+        this, &UInteractionDetectorComponent::HandleControllerChanged);
   }
-  VisibleInteractables.Empty();
+  ReleaseViewerIndex();
   CurrentTarget = nullptr;
+  ExternalTarget = FInteractionExternalTarget();
+  FlushPendingResults(true);
+
+  if (UInteractionRegistrySubsystem *Registry =
+          GetWorld()->GetSubsystem<UInteractionRegistrySubsystem>()) {
+    Registry->UnregisterDetector(this);
+  }
+
+  // Unanswered predictions can no longer be confirmed
+  while (!PendingPredictions.IsEmpty()) {
+    ResolvePrediction(0, EInteractionResultCode::Expired, true);
+  }
 
   Super::EndPlay(EndPlayReason);
 }
 
+bool UInteractionDetectorComponent::HasValidTarget() const {
+  return CurrentTarget != nullptr || ShouldUseExternalTarget();
+}
+
+bool UInteractionDetectorComponent::ShouldUseExternalTarget() const {
+  // Entity ids are local to each machine's Mass world and are never sent to
+  // the server, so only authority can act on them; the nearer kind wins
+  const AActor *Owner = GetOwner();
+  return ExternalTarget.IsValid() && Owner && Owner->HasAuthority() &&
+         (!CurrentTarget ||
+          ExternalTarget.DistanceSq < CurrentTargetDistanceSq);
+}
+
 void UInteractionDetectorComponent::TryInteract() {
-  if (CurrentTarget && CurrentTarget->CanInteract()) {
+  if (ShouldUseExternalTarget()) {
+    FInteractionEvent Event = FInteractionEvent::MakeForEntity(
+        ExternalTarget.EntityId, ExternalTarget.TypeId, GetOwner());
+    FInteractionRouterRegistry::Route(Event);
+    return;
+  }
+
+  if (!CurrentTarget || !CurrentTarget->CanInteract()) {
+    return;
+  }
+
+  // Server, listen host and standalone interact directly
+  if (GetOwner()->HasAuthority()) {
     CurrentTarget->TryInteract(GetOwner());
+    return;
+  }
+
+  // Local handles mean the server does not know this interactable
+  const FInteractableHandle Handle = CurrentTarget->GetNetHandle();
+  if (!Handle.IsValid() || Handle.IsLocal()) {
+    return;
+  }
+
+  const uint16 RequestId = ++LastRequestId;
+  ServerRequestInteract(Handle, GetServerTimeSeconds(), RequestId);
+
+  const UInteractionSettings *Settings = UInteractionSettings::Get();
+  if (Settings && Settings->bEnableClientPrediction) {
+    PredictInteraction(RequestId, CurrentTarget);
   }
 }
 
+void UInteractionDetectorComponent::PredictInteraction(
+    uint16 RequestId, UInteractableComponent *Target) {
+  const UInteractionSettings *Settings = UInteractionSettings::Get();
+  const int32 MaxPending = Settings ? Settings->MaxPendingPredictions : 8;
+  while (PendingPredictions.Num() >= MaxPending) {
+    ResolvePrediction(0, EInteractionResultCode::Expired, true);
+  }
+
+  FPendingPrediction &Prediction = PendingPredictions.AddDefaulted_GetRef();
+  Prediction.RequestId = RequestId;
+  Prediction.Target = Target;
+  Prediction.StartTime = GetWorld()->GetRealTimeSeconds();
+  ++PredictionStats.NumPredicted;
+
+  // A used target stops being targetable until the server answers
+  Target->BeginPredictedUse(GetOwner());
+  UpdateInteractables();
+}
+
+void UInteractionDetectorComponent::ResolvePrediction(
+    int32 Index, EInteractionResultCode Code, bool bTimedOut) {
+  const FPendingPrediction Prediction = PendingPredictions[Index];
+  PendingPredictions.RemoveAt(Index);
+
+  if (Code == EInteractionResultCode::Accepted) {
+    const float LatencySaved = static_cast<float>(
+        GetWorld()->GetRealTimeSeconds() - Prediction.StartTime);
+    ++PredictionStats.NumConfirmed;
+    PredictionStats.TotalLatencySavedSeconds += LatencySaved;
+    PredictionStats.MaxLatencySavedSeconds =
+        FMath::Max(PredictionStats.MaxLatencySavedSeconds, LatencySaved);
+  } else if (bTimedOut) {
+    ++PredictionStats.NumTimedOut;
+  } else {
+    ++PredictionStats.NumRolledBack;
+  }
+
+  if (UInteractableComponent *Target = Prediction.Target.Get()) {
+    Target->EndPredictedUse(Code);
+  }
+}
+
+void UInteractionDetectorComponent::ExpirePredictions() {
+  if (PendingPredictions.IsEmpty()) {
+    return;
+  }
+
+  // Oldest first; a result arriving after its timeout is ignored, and any
+  // state the server did change still arrives through replication
+  const UInteractionSettings *Settings = UInteractionSettings::Get();
+  const double Timeout = Settings ? Settings->PredictionTimeoutSeconds : 2.0;
+  const double Now = GetWorld()->GetRealTimeSeconds();
+  while (!PendingPredictions.IsEmpty() &&
+         Now - PendingPredictions[0].StartTime > Timeout) {
+    ResolvePrediction(0, EInteractionResultCode::Expired, true);
+  }
+}
+
+void UInteractionDetectorComponent::ServerRequestInteract_Implementation(
+    FInteractableHandle Target, float ClientTimeSeconds, uint16 RequestId) {
+  CSV_SCOPED_TIMING_STAT(Interaction, Validation);
+  INTERACTION_SCOPE_CYCLE_COUNTER(STAT_InteractionValidation);
+
+  const UInteractionRegistrySubsystem *Registry =
+      GetWorld()->GetSubsystem<UInteractionRegistrySubsystem>();
+  UInteractableComponent *Interactable =
+      Registry ? Registry->Resolve(Target) : nullptr;
+
+  FInteractionResult &Result = PendingResults.AddDefaulted_GetRef();
+  Result.RequestId = RequestId;
+  Result.Target = Target;
+  Result.Code = ValidateRequest(Interactable, ClientTimeSeconds);
+
+  if (Result.Code == EInteractionResultCode::Accepted) {
+    Interactable->TryInteract(GetOwner());
+  }
+}
+
+void UInteractionDetectorComponent::ClientReceiveResults_Implementation(
+    const TArray<FInteractionResult> &Results) {
+  const UInteractionRegistrySubsystem *Registry =
+      GetWorld()->GetSubsystem<UInteractionRegistrySubsystem>();
+  for (const FInteractionResult &Result : Results) {
+    const int32 PredictionIndex = PendingPredictions.IndexOfByPredicate(
+        [&Result](const FPendingPrediction &Prediction) {
+          return Prediction.RequestId == Result.RequestId;
+        });
+    if (PredictionIndex != INDEX_NONE) {
+      ResolvePrediction(PredictionIndex, Result.Code, false);
+    }
+
+    OnInteractionResult.Broadcast(
+        Result, Registry ? Registry->Resolve(Result.Target) : nullptr);
+  }
+}
+
+EInteractionResultCode
+UInteractionDetectorComponent::ValidateRequest(UInteractableComponent *Target,
+                                               float ClientTimeSeconds) {
+  // Rate limit first so floods of bogus requests stay cheap
+  if (!ConsumeRequestToken()) {
+    return EInteractionResultCode::RateLimited;
+  }
+  if (!Target || !GetOwner()) {
+    return EInteractionResultCode::InvalidTarget;
+  }
+  if (!Target->CanInteract()) {
+    return EInteractionResultCode::Disabled;
+  }
+
+  const UInteractionSettings *Settings = UInteractionSettings::Get();
+  // Timestamps from the future are as invalid as stale ones
+  const float RequestAge = GetServerTimeSeconds() - ClientTimeSeconds;
+  if (Settings && Settings->MaxRequestAgeSeconds > 0.0f &&
+      (RequestAge > Settings->MaxRequestAgeSeconds ||
+       RequestAge < -Settings->MaxRequestClockSkewSeconds)) {
+    return EInteractionResultCode::Expired;
+  }
+
+  const AActor *TargetActor = Target->GetOwner();
+  const float AllowedRadius =
+      UInteractableDefinition::ResolveInteractionRadius(Target->GetDefinition(),
+                                                        InteractionRadius) +
+      (Settings ? Settings->ServerRangeTolerance : 0.0f);
+  if (!TargetActor ||
+      FVector::DistSquared(GetOwner()->GetActorLocation(),
+                           TargetActor->GetActorLocation()) >
+          FMath::Square(AllowedRadius)) {
+    return EInteractionResultCode::OutOfRange;
+  }
+
+  return EInteractionResultCode::Accepted;
+}
+
+bool UInteractionDetectorComponent::ConsumeRequestToken() {
+  const UInteractionSettings *Settings = UInteractionSettings::Get();
+  const float RefillRate = Settings ? Settings->MaxRequestsPerSecond : 5.0f;
+  const float Burst = Settings ? Settings->RequestBurst : 3.0f;
+
+  const double Now = GetWorld()->GetTimeSeconds();
+  RequestTokens = FMath::Min(
+      Burst, RequestTokens + static_cast<float>(Now - LastTokenRefillTime) *
+                                 RefillRate);
+  LastTokenRefillTime = Now;
+
+  if (RequestTokens < 1.0f) {
+    return false;
+  }
+  RequestTokens -= 1.0f;
+  return true;
+}
+
+void UInteractionDetectorComponent::FlushPendingResults(bool bForce) {
+  if (PendingResults.IsEmpty()) {
+    return;
+  }
+
+  // One client RPC per owner net update instead of one per request
+  const AActor *Owner = GetOwner();
+  const double Now = GetWorld()->GetTimeSeconds();
+  const float NetUpdateFrequency =
+      Owner ? FMath::Max(Owner->GetNetUpdateFrequency(), 1.0f) : 1.0f;
+  if (!bForce && Now - LastResultFlushTime < 1.0 / NetUpdateFrequency) {
+    return;
+  }
+
+  ClientReceiveResults(PendingResults);
+  PendingResults.Reset();
+  LastResultFlushTime = Now;
+}
+
+float UInteractionDetectorComponent::GetServerTimeSeconds() const {
+  const UWorld *World = GetWorld();
+  if (const AGameStateBase *GameState = World->GetGameState()) {
+    return GameState->GetServerWorldTimeSeconds();
+  }
+  return World->GetTimeSeconds();
+}
+
 void UInteractionDetectorComponent::ForceUpdateDetection() {
   UpdateInteractables();
 }
 
+APlayerController *UInteractionDetectorComponent::GetLocalViewer() const {
+  const APawn *Pawn = Cast<APawn>(GetOwner());
+  APlayerController *PC = Pawn ? Pawn->GetController<APlayerController>()
+                               : nullptr;
+  return PC && PC->IsLocalController() ? PC : nullptr;
+}
+
+void UInteractionDetectorComponent::SetTypeFilter(
+    const FGameplayTagQuery &NewTypeFilter) {
+  TypeFilter = NewTypeFilter;
+  CompiledTypeFilter.SetQuery(TypeFilter);
+}
+
 void UInteractionDetectorComponent::UpdateInteractables() {
+  CSV_SCOPED_TIMING_STAT(Interaction, Detection);
+  INTERACTION_SCOPE_CYCLE_COUNTER(STAT_InteractionDetection);
+  LLM_SCOPE_BYTAG(Interaction_Detection);
+
   AActor *Owner = GetOwner();
   if (!Owner) {
     SetCurrentTarget(nullptr);
@@ -79,82 +483,197 @@ void UInteractionDetectorComponent::UpdateInteractables() {
   }
 
   const FVector OwnerLocation = Owner->GetActorLocation();
-  const float VisibilityRadiusSq = VisibilityRadius * VisibilityRadius;
-  const float InteractionRadiusSq = InteractionRadius * InteractionRadius;
-
   // Track which interactables are still visible
-  TSet<UInteractableComponent *> StillVisibleSet;
+  const bool bTrackVisible =
+      ViewerIndex != INDEX_NONE || bAlwaysTrackVisibleSet;
+  StillVisibleSet.Reset();
 
   // Find nearest for interaction target
   UInteractableComponent *NearestInteractable = nullptr;
-  float NearestDistanceSq = InteractionRadiusSq;
+  double NearestDistanceSq = TNumericLimits<float>::Max();
+
+  // Marker prefetch: the owner's path over the next PrefetchHorizon seconds
+  const FVector PrefetchLocation =
+      OwnerLocation + Owner->GetVelocity() * PrefetchHorizon;
+  const float PrefetchDistance = FVector::Dist(OwnerLocation, PrefetchLocation);
+  int32 PrefetchBudget =
+      ViewerIndex != INDEX_NONE && PrefetchDistance > KINDA_SMALL_NUMBER
+          ? MaxPrefetchesPerUpdate
+          : 0;
+
+  const UInteractionRegistrySubsystem *Registry =
+      GetWorld()->GetSubsystem<UInteractionRegistrySubsystem>();
+  if (!Registry) {
+    SetCurrentTarget(nullptr);
+    return;
+  }
 
-  // Scan all actors
-  for (TActorIterator<AActor> It(GetWorld()); It; ++It) {
-    AActor *Actor = *It;
-    if (Actor == Owner) {
+  // Baked cells around the owner plus the unindexed interactables
+  Registry->GatherCandidates(OwnerLocation, VisibilityRadius, PrefetchDistance,
+                             Candidates);
+  INC_DWORD_STAT_BY(STAT_InteractionCandidatesScanned, Candidates.Num());
+
+  // Keep the usable candidates and lay their locations out for the kernels
+  int32 NumCandidates = 0;
+  CandidateLocations.SetNumUninitialized(Candidates.Num(), EAllowShrinking::No);
+  for (UInteractableComponent *InteractableComp : Candidates) {
+    AActor *Actor = InteractableComp ? InteractableComp->GetOwner() : nullptr;
+    if (!Actor || Actor == Owner) {
       continue;
     }
 
-    UInteractableComponent *InteractableComp =
-        Actor->FindComponentByClass<UInteractableComponent>();
-    if (!InteractableComp || !InteractableComp->CanInteract()) {
+    if (!InteractableComp->CanInteract() ||
+        InteractableComp->IsPredictedUse() ||
+        !CompiledTypeFilter.Matches(InteractableComp->GetInteractionTypeId())) {
       continue;
     }
 
-    const float DistanceSq =
-        FVector::DistSquared(OwnerLocation, Actor->GetActorLocation());
+    Candidates[NumCandidates] = InteractableComp;
+    CandidateLocations[NumCandidates++] = Actor->GetActorLocation();
+  }
+  Candidates.SetNum(NumCandidates, EAllowShrinking::No);
+  CandidateLocations.SetNum(NumCandidates, EAllowShrinking::No);
+  CandidateIndices.SetNumUninitialized(NumCandidates, EAllowShrinking::No);
+
+  // Instances of one kind tend to be registered together, so the radii are
+  // resolved and the kernels run once per run of a definition
+  for (int32 RunStart = 0; RunStart < NumCandidates;) {
+    const UInteractableDefinition *Definition =
+        Candidates[RunStart]->GetDefinition();
+    int32 RunEnd = RunStart + 1;
+    while (RunEnd < NumCandidates &&
+           Candidates[RunEnd]->GetDefinition() == Definition) {
+      ++RunEnd;
+    }
+
+    const float CandidateVisibilityRadius =
+        UInteractableDefinition::ResolveVisibilityRadius(Definition,
+                                                         VisibilityRadius);
+    const double CandidateVisibilityRadiusSq =
+        FMath::Square(CandidateVisibilityRadius);
+    const double CandidateInteractionRadiusSq = FMath::Square(
+        UInteractableDefinition::ResolveInteractionRadius(Definition,
+                                                          InteractionRadius));
+    const TConstArrayView<FVector> RunLocations(
+        CandidateLocations.GetData() + RunStart, RunEnd - RunStart);
+    UInteractableComponent *const *RunCandidates =
+        Candidates.GetData() + RunStart;
 
-    // Check visibility radius
-    if (DistanceSq < VisibilityRadiusSq) {
-      StillVisibleSet.Add(InteractableComp);
+    const int32 NumVisible = InteractionMath::CullByDistance(
+        RunLocations, OwnerLocation, CandidateVisibilityRadiusSq,
+        CandidateIndices.GetData());
+    const TConstArrayView<int32> VisibleIndices(CandidateIndices.GetData(),
+                                                NumVisible);
 
-      // Check if newly visible
-      if (!VisibleInteractables.Contains(InteractableComp)) {
-        InteractableComp->SetVisible(true);
+    // Visibility only drives markers; detectors without a viewer bit
+    // (headless) just pick a target unless asked to keep the visible set
+    if (bTrackVisible) {
+      for (const int32 Index : VisibleIndices) {
+        UInteractableComponent *InteractableComp = RunCandidates[Index];
+        StillVisibleSet.Add(InteractableComp);
+
+        // Newly visible: this viewer's bit is still clear
+        if (ViewerIndex != INDEX_NONE &&
+            !InteractableComp->IsVisibleTo(ViewerIndex)) {
+          if (!InteractableComp->WasMarkerShown()) {
+            RecordPrefetchResult(InteractableComp->IsMarkerPrepared());
+          }
+          InteractableComp->SetVisible(ViewerIndex, true);
+        }
       }
+    }
+
+    // Strictly nearer than earlier runs, so the first equidistant one wins
+    double RunNearestDistanceSq = 0.0;
+    const int32 RunNearest = InteractionMath::FindNearest(
+        RunLocations, VisibleIndices, OwnerLocation,
+        FMath::Min(CandidateInteractionRadiusSq, NearestDistanceSq),
+        RunNearestDistanceSq);
+    if (RunNearest != INDEX_NONE) {
+      NearestDistanceSq = RunNearestDistanceSq;
+      NearestInteractable = RunCandidates[RunNearest];
+    }
+
+    if (PrefetchBudget > 0) {
+      const int32 NumNear = InteractionMath::CullByDistance(
+          RunLocations, OwnerLocation,
+          FMath::Square(CandidateVisibilityRadius + PrefetchDistance),
+          CandidateIndices.GetData());
+      for (int32 i = 0; i < NumNear && PrefetchBudget > 0; ++i) {
+        const int32 Index = CandidateIndices[i];
+        UInteractableComponent *InteractableComp = RunCandidates[Index];
 
-      // Check interaction radius (for current target)
-      if (DistanceSq < NearestDistanceSq) {
-        NearestDistanceSq = DistanceSq;
-        NearestInteractable = InteractableComp;
+        // The owner is heading into this marker's visibility ring
+        if (FVector::DistSquared(OwnerLocation, RunLocations[Index]) >=
+                CandidateVisibilityRadiusSq &&
+            !InteractableComp->IsMarkerPrepared() &&
+            FMath::PointDistToSegmentSquared(RunLocations[Index],
+                                             OwnerLocation,
+                                             PrefetchLocation) <
+                CandidateVisibilityRadiusSq &&
+            InteractableComp->PrepareMarker()) {
+          --PrefetchBudget;
+          ++PrefetchStats.NumPrefetched;
+          INC_DWORD_STAT(STAT_InteractionMarkersPrefetched);
+        }
       }
     }
+
+    RunStart = RunEnd;
   }
 
-  // Hide interactables that are no longer visible
-  for (int32 i = VisibleInteractables.Num() - 1; i >= 0; --i) {
-    UInteractableComponent *Interactable = VisibleInteractables[i];
-    if (Interactable && !StillVisibleSet.Contains(Interactable)) {
-      Interactable->SetVisible(false);
-      Interactable->SetInteractable(false);
-      VisibleInteractables.RemoveAt(i);
+  if (bTrackVisible) {
+    INTERACTION_SCOPE_CYCLE_COUNTER(STAT_InteractionVisibilityDiff);
+
+    // Hide interactables that are no longer visible
+    if (ViewerIndex != INDEX_NONE) {
+      for (UInteractableComponent *Interactable : VisibleInteractables) {
+        if (Interactable && !StillVisibleSet.Contains(Interactable)) {
+          Interactable->SetVisible(ViewerIndex, false);
+          Interactable->SetInteractable(ViewerIndex, false);
+        }
+      }
     }
-  }
 
-  // Add newly visible interactables to the list
-  for (UInteractableComponent *Interactable : StillVisibleSet) {
-    if (!VisibleInteractables.Contains(Interactable)) {
+    // The visible list becomes this pass's set
+    VisibleInteractables.Reset(StillVisibleSet.Num());
+    for (UInteractableComponent *Interactable : StillVisibleSet) {
       VisibleInteractables.Add(Interactable);
     }
+    INC_DWORD_STAT_BY(STAT_InteractionVisibleMarkers,
+                      VisibleInteractables.Num());
   }
 
   // Update interaction target
+  CurrentTargetDistanceSq = static_cast<float>(NearestDistanceSq);
   SetCurrentTarget(NearestInteractable);
 }
 
+void UInteractionDetectorComponent::RecordPrefetchResult(bool bHit) {
+  if (bHit) {
+    ++PrefetchStats.NumHits;
+    INC_DWORD_STAT(STAT_InteractionPrefetchHits);
+    CSV_CUSTOM_STAT(Interaction, PrefetchHits, 1, ECsvCustomStatOp::Accumulate);
+  } else {
+    ++PrefetchStats.NumMisses;
+    INC_DWORD_STAT(STAT_InteractionPrefetchMisses);
+    CSV_CUSTOM_STAT(Interaction, PrefetchMisses, 1,
+                    ECsvCustomStatOp::Accumulate);
+  }
+}
+
 void UInteractionDetectorComponent::SetCurrentTarget(
     UInteractableComponent *NewTarget) {
   if (CurrentTarget != NewTarget) {
     // Deactivate old target - text panel hides immediately
-    if (CurrentTarget) {
-      CurrentTarget->SetInteractable(false);
+    if (CurrentTarget && ViewerIndex != INDEX_NONE) {
+      CurrentTarget->SetInteractable(ViewerIndex, false);
     }
 
     // Activate new target
     CurrentTarget = NewTarget;
-    if (CurrentTarget) {
-      CurrentTarget->SetInteractable(true);
+    if (CurrentTarget && ViewerIndex != INDEX_NONE) {
+      CurrentTarget->SetInteractable(ViewerIndex, true);
     }
 
     OnTargetChanged.Broadcast(NewTarget);
@@ -0,0 +1,156 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "InteractionEvent.h"
+#include "GameFramework/Actor.h"
+#include "InteractableComponent.h"
+#include "Misc/ScopeRWLock.h"
+#include <atomic>
+
+namespace InteractionTypeRegistry {
+/** Registered types, index = id (slot 0 reserved) */
+FGameplayTag Tags[FInteractionTypeRegistry::MaxTypes];
+
+/** Number of published slots */
+std::atomic<int32> NumTags{1};
+
+/** Lookup for registration */
+TMap<FGameplayTag, FInteractionTypeId> Ids;
+FRWLock Lock;
+} // namespace InteractionTypeRegistry
+
+FInteractionTypeId
+FInteractionTypeRegistry::GetId(const FGameplayTag &InteractionType) {
+  using namespace InteractionTypeRegistry;
+
+  if (!InteractionType.IsValid()) {
+    return 0;
+  }
+
+  {
+    FReadScopeLock ReadLock(Lock);
+    if (const FInteractionTypeId *Existing = Ids.Find(InteractionType)) {
+      return *Existing;
+    }
+  }
+
+  FWriteScopeLock WriteLock(Lock);
+  if (const FInteractionTypeId *Existing = Ids.Find(InteractionType)) {
+    return *Existing;
+  }
+
+  const int32 NewId = NumTags.load(std::memory_order_relaxed);
+  if (NewId >= MaxTypes) {
+    return 0;
+  }
+
+  Tags[NewId] = InteractionType;
+  Ids.Add(InteractionType, static_cast<FInteractionTypeId>(NewId));
+  NumTags.store(NewId + 1, std::memory_order_release);
+  return static_cast<FInteractionTypeId>(NewId);
+}
+
+FGameplayTag FInteractionTypeRegistry::GetTag(FInteractionTypeId TypeId) {
+  using namespace InteractionTypeRegistry;
+  return TypeId < NumTags.load(std::memory_order_acquire) ? Tags[TypeId]
+                                                          : FGameplayTag();
+}
+
+int32 FInteractionTypeRegistry::Num() {
+  return InteractionTypeRegistry::NumTags.load(std::memory_order_acquire);
+}
+
+//~ FInteractionTypeFilter
+
+FInteractionTypeFilter::FInteractionTypeFilter(
+    const FGameplayTagQuery &InQuery) {
+  SetQuery(InQuery);
+}
+
+void FInteractionTypeFilter::SetQuery(const FGameplayTagQuery &InQuery) {
+  Query = InQuery;
+  bMatchAll = Query.IsEmpty();
+  FMemory::Memzero(Mask);
+  NumCompiled = 1;
+}
+
+void FInteractionTypeFilter::CompileNewTypes() const {
+  // Id 0 (unknown / overflow) never matches a non-empty query
+  const int32 NumTypes = FInteractionTypeRegistry::Num();
+  for (int32 TypeId = NumCompiled; TypeId < NumTypes; ++TypeId) {
+    const FGameplayTag Tag =
+        FInteractionTypeRegistry::GetTag(static_cast<FInteractionTypeId>(TypeId));
+    if (Query.Matches(FGameplayTagContainer(Tag))) {
+      Mask[TypeId >> 6] |= 1ull << (TypeId & 63);
+    }
+  }
+  NumCompiled = FMath::Max(NumCompiled, NumTypes);
+}
+
+FInteractionEvent
+FInteractionEvent::Make(const UInteractableComponent *Component,
+                        const AActor *InteractionInstigator) {
+  FInteractionEvent Event;
+  Event.Instigator = FObjectKey(InteractionInstigator);
+  Event.TargetComponent = FObjectKey(Component);
+  Event.Timestamp = FPlatformTime::Seconds();
+  Event.FrameNumber = static_cast<uint32>(GFrameCounter);
+  Event.TypeId = Component ? Component->GetInteractionTypeId() : 0;
+  return Event;
+}
+
+FInteractionEvent
+FInteractionEvent::MakeForEntity(uint64 EntityId, FInteractionTypeId TypeId,
+                                 const AActor *InteractionInstigator) {
+  FInteractionEvent Event;
+  Event.Instigator = FObjectKey(InteractionInstigator);
+  Event.TargetEntity = EntityId;
+  Event.Timestamp = FPlatformTime::Seconds();
+  Event.FrameNumber = static_cast<uint32>(GFrameCounter);
+  Event.TypeId = TypeId;
+  return Event;
+}
+
+FInteractionEvent
+FInteractionEvent::FromEventData(const FInteractionEventData &EventData) {
+  FInteractionEvent Event;
+  Event.Instigator = FObjectKey(EventData.Instigator);
+  Event.TargetComponent = FObjectKey(EventData.TargetComponent);
+  Event.Timestamp = FPlatformTime::Seconds();
+  Event.FrameNumber = static_cast<uint32>(GFrameCounter);
+  Event.TypeId = FInteractionTypeRegistry::GetId(EventData.InteractionType);
+  Event.SetHandled(EventData.bHandled);
+  return Event;
+}
+
+FInteractionEventData FInteractionEvent::ToEventData() const {
+  FInteractionEventData EventData;
+  EventData.Instigator = ResolveInstigator();
+  EventData.TargetComponent = ResolveTargetComponent();
+  EventData.TargetActor =
+      EventData.TargetComponent ? EventData.TargetComponent->GetOwner()
+                                : nullptr;
+  EventData.InteractionType = GetInteractionType();
+  EventData.DisplayText = EventData.TargetComponent
+                              ? EventData.TargetComponent->GetDisplayText()
+                              : FText::GetEmpty();
+  EventData.bHandled = IsHandled();
+  return EventData;
+}
+
+AActor *FInteractionEvent::ResolveInstigator() const {
+  return Cast<AActor>(Instigator.ResolveObjectPtr());
+}
+
+UInteractableComponent *FInteractionEvent::ResolveTargetComponent() const {
+  return Cast<UInteractableComponent>(TargetComponent.ResolveObjectPtr());
+}
+
+AActor *FInteractionEvent::ResolveTargetActor() const {
+  const UInteractableComponent *Component = ResolveTargetComponent();
+  return Component ? Component->GetOwner() : nullptr;
+}
+
+FText FInteractionEvent::ResolveDisplayText() const {
+  const UInteractableComponent *Component = ResolveTargetComponent();
+  return Component ? Component->GetDisplayText() : FText::GetEmpty();
+}
@@ -0,0 +1,176 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "InteractionInitQueueSubsystem.h"
+#include "Blueprint/UserWidget.h"
+#include "Engine/AssetManager.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "InteractableComponent.h"
+#include "InteractionProfiling.h"
+#include "InteractionSettings.h"
+#include "InteractionSystem.h"
+
+namespace InteractionInitQueueSubsystem {
+/** Seconds between re-sorts of a queue that is still draining */
+static constexpr double ResortIntervalSeconds = 0.5;
+} // namespace InteractionInitQueueSubsystem
+
+void UInteractionInitQueueSubsystem::Deinitialize() {
+  Pending.Empty();
+  for (TPair<FSoftObjectPath, FWidgetClassLoad> &Pair : WidgetClassLoads) {
+    if (Pair.Value.Handle) {
+      Pair.Value.Handle->ReleaseHandle();
+    }
+  }
+  WidgetClassLoads.Empty();
+  NumWaitingForClass = 0;
+  Super::Deinitialize();
+}
+
+bool UInteractionInitQueueSubsystem::DoesSupportWorldType(
+    const EWorldType::Type WorldType) const {
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UInteractionInitQueueSubsystem::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(UInteractionInitQueueSubsystem,
+                                  STATGROUP_Tickables);
+}
+
+void UInteractionInitQueueSubsystem::Enqueue(
+    UInteractableComponent *Interactable) {
+  LLM_SCOPE_BYTAG(Interaction_Markers);
+  if (!Interactable) {
+    return;
+  }
+
+  // Resident (or unset) classes go straight to the budgeted queue
+  const TSoftClassPtr<UUserWidget> &ClassPath =
+      Interactable->GetMarkerWidgetClassPath();
+  const FSoftObjectPath &Path = ClassPath.ToSoftObjectPath();
+  FWidgetClassLoad *Load = WidgetClassLoads.Find(Path);
+  if (ClassPath.IsNull() || ClassPath.Get() ||
+      (Load && Load->Handle && Load->Handle->HasLoadCompleted())) {
+    Pending.Add(Interactable);
+    bNeedsSort = true;
+    return;
+  }
+
+  ++NumWaitingForClass;
+  if (Load) {
+    Load->Waiting.Add(Interactable);
+    return;
+  }
+  WidgetClassLoads.Add(Path).Waiting.Add(Interactable);
+
+  // The callback may run before RequestAsyncLoad returns
+  TSharedPtr<FStreamableHandle> Handle =
+      UAssetManager::GetStreamableManager().RequestAsyncLoad(
+          Path, FStreamableDelegate::CreateUObject(
+                    this,
+                    &UInteractionInitQueueSubsystem::HandleWidgetClassLoaded,
+                    Path));
+  if (FWidgetClassLoad *Started = WidgetClassLoads.Find(Path)) {
+    Started->Handle = MoveTemp(Handle);
+  }
+}
+
+void UInteractionInitQueueSubsystem::HandleWidgetClassLoaded(
+    FSoftObjectPath ClassPath) {
+  FWidgetClassLoad *Load = WidgetClassLoads.Find(ClassPath);
+  if (!Load) {
+    return;
+  }
+  UE_CLOG(!ClassPath.ResolveObject(), LogInteractionSystem, Warning,
+          TEXT("Marker widget class %s failed to load, %d markers left without one"),
+          *ClassPath.ToString(), Load->Waiting.Num());
+
+  NumWaitingForClass -= Load->Waiting.Num();
+  Pending.Append(MoveTemp(Load->Waiting));
+  Load->Waiting.Empty();
+  bNeedsSort = true;
+}
+
+void UInteractionInitQueueSubsystem::Tick(float DeltaTime) {
+  Super::Tick(DeltaTime);
+  if (Pending.IsEmpty()) {
+    return;
+  }
+
+  INTERACTION_SCOPE_CYCLE_COUNTER(STAT_InteractionMarkerInit);
+  LLM_SCOPE_BYTAG(Interaction_Markers);
+
+  const double StartTime = FPlatformTime::Seconds();
+  if (bNeedsSort ||
+      StartTime - LastSortTime >
+          InteractionInitQueueSubsystem::ResortIntervalSeconds) {
+    SortByViewerDistance();
+    LastSortTime = StartTime;
+  }
+
+  const UInteractionSettings *Settings = UInteractionSettings::Get();
+  const double BudgetSeconds =
+      (Settings ? Settings->MarkerInitBudgetMs : 1.0f) / 1000.0;
+
+  // At least one setup per frame, even if it alone exceeds the budget
+  do {
+    if (UInteractableComponent *Interactable =
+            Pending.Pop(EAllowShrinking::No).Get()) {
+      Interactable->CreateMarker();
+      INC_DWORD_STAT(STAT_InteractionMarkersInitialized);
+    }
+  } while (!Pending.IsEmpty() &&
+           FPlatformTime::Seconds() - StartTime < BudgetSeconds);
+
+  if (Pending.IsEmpty()) {
+    Pending.Empty();
+  }
+}
+
+void UInteractionInitQueueSubsystem::SortByViewerDistance() {
+  bNeedsSort = false;
+
+  TArray<FVector, TInlineAllocator<4>> ViewLocations;
+  for (FConstPlayerControllerIterator It =
+           GetWorld()->GetPlayerControllerIterator();
+       It; ++It) {
+    const APlayerController *PC = It->Get();
+    if (PC && PC->IsLocalController()) {
+      FVector Location;
+      FRotator Rotation;
+      PC->GetPlayerViewPoint(Location, Rotation);
+      ViewLocations.Add(Location);
+    }
+  }
+  if (ViewLocations.IsEmpty()) {
+    return;
+  }
+
+  const auto NearestViewDistanceSq =
+      [&ViewLocations](const TWeakObjectPtr<UInteractableComponent> &Entry) {
+        const UInteractableComponent *Interactable = Entry.Get();
+        const AActor *Owner = Interactable ? Interactable->GetOwner() : nullptr;
+        if (!Owner) {
+          return TNumericLimits<double>::Max();
+        }
+        double NearestSq = TNumericLimits<double>::Max();
+        for (const FVector &ViewLocation : ViewLocations) {
+          NearestSq = FMath::Min(
+              NearestSq,
+              FVector::DistSquared(ViewLocation, Owner->GetActorLocation()));
+        }
+        return NearestSq;
+      };
+
+  // Key once per entry rather than per comparison
+  TArray<TPair<double, TWeakObjectPtr<UInteractableComponent>>> Keyed;
+  Keyed.Reserve(Pending.Num());
+  for (const TWeakObjectPtr<UInteractableComponent> &Entry : Pending) {
+    Keyed.Emplace(NearestViewDistanceSq(Entry), Entry);
+  }
+  Keyed.Sort([](const auto &A, const auto &B) { return A.Key > B.Key; });
+
+  for (int32 i = 0; i < Keyed.Num(); ++i) {
+    Pending[i] = Keyed[i].Value;
+  }
+}
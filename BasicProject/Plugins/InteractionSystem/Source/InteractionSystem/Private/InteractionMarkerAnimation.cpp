@@ -0,0 +1,12 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "InteractionMarkerAnimation.h"
+#include "InteractionMath.h"
+
+bool FInteractionMarkerAnimation::Step(float DeltaTime, float FadeDuration,
+                                       float Elasticity) {
+  return InteractionMath::StepSpringFade(
+      Scale, ScaleVelocity, TargetScale, Opacity, TargetOpacity,
+      InteractionMath::FSpringParams::Make(FadeDuration, Elasticity),
+      DeltaTime);
+}
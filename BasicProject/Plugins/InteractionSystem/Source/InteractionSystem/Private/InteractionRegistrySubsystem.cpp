@@ -0,0 +1,477 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "InteractionRegistrySubsystem.h"
+#include "Components/SceneComponent.h"
+#include "Engine/Level.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "InteractableComponent.h"
+#include "InteractableDefinition.h"
+#include "InteractableIndexActor.h"
+#include "InteractionDetectorComponent.h"
+#include "InteractionProfiling.h"
+#include "InteractionSystem.h"
+
+namespace InteractionRegistrySubsystem {
+static FAutoConsoleCommandWithWorldAndArgs DumpMemoryCommand(
+    TEXT("Interaction.DumpMemory"),
+    TEXT("Log the memory held by registered interactables (component, marker "
+         "widget component, UMG tree), per owner class."),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+        [](const TArray<FString> &Args, UWorld *World) {
+          if (const UInteractionRegistrySubsystem *Registry =
+                  World ? World->GetSubsystem<UInteractionRegistrySubsystem>()
+                        : nullptr) {
+            Registry->DumpMemory();
+          }
+        }));
+} // namespace InteractionRegistrySubsystem
+
+void UInteractionRegistrySubsystem::Deinitialize() {
+  Slots.Empty();
+  FreeSlots.Empty();
+  LocalSlots.Empty();
+  FreeLocalSlots.Empty();
+  Interactables.Empty();
+  DenseToSlot.Empty();
+  Detectors.Empty();
+  ViewerSlots.Empty();
+  Unindexed.Empty();
+  UnindexedToSlot.Empty();
+  BakedLevels.Empty();
+  Super::Deinitialize();
+}
+
+FInteractableHandle
+UInteractionRegistrySubsystem::Register(UInteractableComponent *Interactable) {
+  LLM_SCOPE_BYTAG(Interaction_Detection);
+  return AddSlot(Interactable, /*bLocal=*/false);
+}
+
+FInteractableHandle UInteractionRegistrySubsystem::RegisterLocal(
+    UInteractableComponent *Interactable) {
+  LLM_SCOPE_BYTAG(Interaction_Detection);
+  return AddSlot(Interactable, /*bLocal=*/true);
+}
+
+FInteractableHandle
+UInteractionRegistrySubsystem::AddSlot(UInteractableComponent *Interactable,
+                                       bool bLocal) {
+  if (!Interactable) {
+    return FInteractableHandle();
+  }
+
+  if (Slots.IsEmpty()) {
+    Slots.AddDefaulted(); // Slot 0 is the invalid handle
+  }
+
+  uint32 SlotIndex = FindSlotIndex(Interactable);
+  if (SlotIndex != 0) {
+    return FInteractableHandle(SlotIndex, GetSlot(SlotIndex).Generation);
+  }
+
+  // Server and local indices come from disjoint ranges, so a replicated
+  // handle can never land on a client-local registration
+  TArray<uint32> &Free = bLocal ? FreeLocalSlots : FreeSlots;
+  if (!Free.IsEmpty()) {
+    SlotIndex = Free.Pop(EAllowShrinking::No);
+  } else if (bLocal) {
+    if (LocalSlots.Num() >= static_cast<int32>(
+                                FInteractableHandle::LocalIndexBit)) {
+      return FInteractableHandle();
+    }
+    SlotIndex = FInteractableHandle::LocalIndexBit | LocalSlots.Num();
+    LocalSlots.AddDefaulted();
+  } else {
+    SlotIndex = Slots.Num();
+    if (SlotIndex >= FInteractableHandle::LocalIndexBit) {
+      return FInteractableHandle();
+    }
+    Slots.AddDefaulted();
+  }
+
+  FSlot &Slot = GetSlot(SlotIndex);
+  Slot.DenseIndex = Interactables.Add(Interactable);
+  DenseToSlot.Add(SlotIndex);
+  LinkBaked(SlotIndex, Interactable);
+  return FInteractableHandle(SlotIndex, GetSlot(SlotIndex).Generation);
+}
+
+void UInteractionRegistrySubsystem::RegisterWithHandle(
+    UInteractableComponent *Interactable, FInteractableHandle Handle,
+    FInteractableHandle PreviousHandle) {
+  LLM_SCOPE_BYTAG(Interaction_Detection);
+  if (!Interactable || !Handle.IsValid() || Handle.IsLocal()) {
+    return;
+  }
+
+  const uint32 SlotIndex = Handle.GetIndex();
+
+  // Drop an entry made under an earlier (e.g. client-local) handle
+  const uint32 PreviousSlotIndex = PreviousHandle.GetIndex();
+  if (PreviousSlotIndex != SlotIndex && IsValidSlot(PreviousSlotIndex) &&
+      GetSlot(PreviousSlotIndex).DenseIndex != INDEX_NONE &&
+      Interactables[GetSlot(PreviousSlotIndex).DenseIndex] == Interactable) {
+    ReleaseSlot(PreviousSlotIndex);
+    if (PreviousHandle.IsLocal()) {
+      FSlot &PreviousSlot = GetSlot(PreviousSlotIndex);
+      PreviousSlot.Generation =
+          (PreviousSlot.Generation + 1) & FInteractableHandle::MaxGeneration;
+      FreeLocalSlots.Add(PreviousSlotIndex);
+    }
+  }
+
+  if (Slots.Num() <= static_cast<int32>(SlotIndex)) {
+    Slots.SetNum(SlotIndex + 1);
+  }
+
+  // The server may have recycled the slot before our copy was unregistered
+  FSlot &Slot = GetSlot(SlotIndex);
+  if (Slot.DenseIndex != INDEX_NONE) {
+    if (Interactables[Slot.DenseIndex] == Interactable) {
+      Slot.Generation = Handle.GetGeneration();
+      return;
+    }
+    ReleaseSlot(SlotIndex);
+  }
+
+  GetSlot(SlotIndex).Generation = Handle.GetGeneration();
+  GetSlot(SlotIndex).DenseIndex = Interactables.Add(Interactable);
+  DenseToSlot.Add(SlotIndex);
+  LinkBaked(SlotIndex, Interactable);
+}
+
+void UInteractionRegistrySubsystem::Unregister(
+    UInteractableComponent *Interactable) {
+  const uint32 SlotIndex = FindSlotIndex(Interactable);
+  if (SlotIndex == 0) {
+    return;
+  }
+
+  ReleaseSlot(SlotIndex);
+
+  // Only the server recycles its slots; clients mirror the server's indices
+  // and only recycle their local range
+  const bool bLocal = (SlotIndex & FInteractableHandle::LocalIndexBit) != 0;
+  if (bLocal || Interactable->GetNetMode() != NM_Client) {
+    FSlot &Slot = GetSlot(SlotIndex);
+    Slot.Generation = (Slot.Generation + 1) & FInteractableHandle::MaxGeneration;
+    (bLocal ? FreeLocalSlots : FreeSlots).Add(SlotIndex);
+  }
+}
+
+void UInteractionRegistrySubsystem::RegisterDetector(
+    UInteractionDetectorComponent *Detector) {
+  LLM_SCOPE_BYTAG(Interaction_Detection);
+  if (Detector) {
+    Detectors.AddUnique(Detector);
+  }
+}
+
+void UInteractionRegistrySubsystem::UnregisterDetector(
+    UInteractionDetectorComponent *Detector) {
+  Detectors.RemoveSingleSwap(Detector, EAllowShrinking::No);
+}
+
+int32 UInteractionRegistrySubsystem::AcquireViewerIndex(
+    UInteractionDetectorComponent *Detector) {
+  if (!Detector) {
+    return INDEX_NONE;
+  }
+
+  int32 ViewerIndex = ViewerSlots.Find(nullptr);
+  if (ViewerIndex == INDEX_NONE) {
+    if (ViewerSlots.Num() >= MaxViewers) {
+      return INDEX_NONE;
+    }
+    ViewerIndex = ViewerSlots.Add(nullptr);
+  }
+  ViewerSlots[ViewerIndex] = Detector;
+  return ViewerIndex;
+}
+
+void UInteractionRegistrySubsystem::ReleaseViewerIndex(int32 ViewerIndex) {
+  if (ViewerSlots.IsValidIndex(ViewerIndex)) {
+    ViewerSlots[ViewerIndex] = nullptr;
+  }
+}
+
+void UInteractionRegistrySubsystem::AddBakedIndex(
+    const AInteractableIndexActor *Index) {
+  LLM_SCOPE_BYTAG(Interaction_Detection);
+  if (!Index || BakedLevels.ContainsByPredicate(
+                    [Index](const FInteractionBakedLevel &Baked) {
+                      return Baked.Index == Index;
+                    })) {
+    return;
+  }
+
+  // Reuse a removed level's entry so FSlot::BakedLevel stays stable
+  int32 LevelIndex = BakedLevels.IndexOfByPredicate(
+      [](const FInteractionBakedLevel &Baked) { return !Baked.Index; });
+  if (LevelIndex == INDEX_NONE) {
+    LevelIndex = BakedLevels.AddDefaulted();
+  }
+
+  // The level transform (level instance, streaming offset) is already
+  // applied to the index actor when its components initialize
+  FInteractionBakedLevel &Baked = BakedLevels[LevelIndex];
+  Baked.Index = Index;
+  Baked.ToWorld = Index->GetActorTransform();
+  Baked.Resolved.Init(nullptr, Index->Num());
+  Baked.MaxDefinitionRadius = 0.0f;
+  const UInteractableDefinition *LastDefinition = nullptr;
+  for (const FInteractableIndexEntry &Entry : Index->GetEntries()) {
+    if (Entry.Definition && Entry.Definition != LastDefinition) {
+      LastDefinition = Entry.Definition;
+      Baked.MaxDefinitionRadius =
+          FMath::Max3(Baked.MaxDefinitionRadius,
+                      LastDefinition->VisibilityRadius,
+                      LastDefinition->InteractionRadius);
+    }
+  }
+
+  // The indexed actors register during this frame's BeginPlay; grow once
+  const int32 NumIncoming = Index->Num();
+  Slots.Reserve(Slots.Num() + NumIncoming + 1);
+  Interactables.Reserve(Interactables.Num() + NumIncoming);
+  DenseToSlot.Reserve(DenseToSlot.Num() + NumIncoming);
+}
+
+void UInteractionRegistrySubsystem::RemoveBakedIndex(
+    const AInteractableIndexActor *Index) {
+  for (FInteractionBakedLevel &Baked : BakedLevels) {
+    if (Baked.Index != Index) {
+      continue;
+    }
+
+    // Interactables still registered fall back to the full scan
+    for (UInteractableComponent *Interactable : Baked.Resolved) {
+      const uint32 SlotIndex = FindSlotIndex(Interactable);
+      if (SlotIndex != 0) {
+        GetSlot(SlotIndex).BakedLevel = INDEX_NONE;
+        AddUnindexed(SlotIndex, Interactable);
+      }
+    }
+    Baked = FInteractionBakedLevel();
+    return;
+  }
+}
+
+void UInteractionRegistrySubsystem::QueryBakedInteractables(
+    const FVector &Origin, float Radius,
+    TFunctionRef<void(const FInteractableIndexEntry &Entry,
+                      const FVector &WorldLocation)>
+        Visit) const {
+  for (const FInteractionBakedLevel &Baked : BakedLevels) {
+    const float Scale = Baked.ToWorld.GetScale3D().GetAbsMin();
+    if (!Baked.Index || Scale <= UE_SMALL_NUMBER) {
+      continue;
+    }
+
+    const TArray<FInteractableIndexEntry> &Entries = Baked.Index->GetEntries();
+    Baked.Index->QueryLocal(
+        Baked.ToWorld.InverseTransformPosition(Origin), Radius / Scale,
+        [&Baked, &Entries, &Visit](int32 EntryIndex) {
+          const FInteractableIndexEntry &Entry = Entries[EntryIndex];
+          Visit(Entry,
+                Baked.ToWorld.TransformPosition(FVector(Entry.Location)));
+        });
+  }
+}
+
+void UInteractionRegistrySubsystem::GatherCandidates(
+    const FVector &Origin, float DetectorRadius, float ExtraDistance,
+    TArray<UInteractableComponent *> &OutCandidates) const {
+  OutCandidates.Reset();
+
+  for (const FInteractionBakedLevel &Baked : BakedLevels) {
+    const float Scale = Baked.ToWorld.GetScale3D().GetAbsMin();
+    if (!Baked.Index || Scale <= UE_SMALL_NUMBER) {
+      continue;
+    }
+
+    const float Radius =
+        FMath::Max(DetectorRadius, Baked.MaxDefinitionRadius) + ExtraDistance;
+    Baked.Index->QueryLocal(Baked.ToWorld.InverseTransformPosition(Origin),
+                            Radius / Scale,
+                            [&Baked, &OutCandidates](int32 EntryIndex) {
+                              if (UInteractableComponent *Interactable =
+                                      Baked.Resolved[EntryIndex]) {
+                                OutCandidates.Add(Interactable);
+                              }
+                            });
+  }
+
+  OutCandidates.Reserve(OutCandidates.Num() + Unindexed.Num());
+  for (UInteractableComponent *Interactable : Unindexed) {
+    OutCandidates.Add(Interactable);
+  }
+}
+
+void UInteractionRegistrySubsystem::LinkBaked(
+    uint32 SlotIndex, UInteractableComponent *Interactable) {
+  const AActor *Owner = Interactable->GetOwner();
+  const USceneComponent *Root = Owner ? Owner->GetRootComponent() : nullptr;
+
+  // Movable interactables leave their baked cell: scan them in full
+  if (Root && Root->Mobility != EComponentMobility::Movable) {
+    const ULevel *Level = Owner->GetLevel();
+    for (int32 LevelIndex = 0; LevelIndex < BakedLevels.Num(); ++LevelIndex) {
+      FInteractionBakedLevel &Baked = BakedLevels[LevelIndex];
+      if (!Baked.Index || Baked.Index->GetLevel() != Level) {
+        continue;
+      }
+
+      const int32 EntryIndex = Baked.Index->FindEntry(
+          Baked.ToWorld.InverseTransformPosition(Owner->GetActorLocation()),
+          Interactable);
+      if (EntryIndex != INDEX_NONE && !Baked.Resolved[EntryIndex]) {
+        Baked.Resolved[EntryIndex] = Interactable;
+        GetSlot(SlotIndex).BakedLevel = LevelIndex;
+        GetSlot(SlotIndex).BakedEntry = EntryIndex;
+        return;
+      }
+      break;
+    }
+  }
+
+  // Not baked (spawned, added after the last save, or moved)
+  GetSlot(SlotIndex).BakedLevel = INDEX_NONE;
+  AddUnindexed(SlotIndex, Interactable);
+}
+
+void UInteractionRegistrySubsystem::AddUnindexed(
+    uint32 SlotIndex, UInteractableComponent *Interactable) {
+  GetSlot(SlotIndex).BakedEntry = Unindexed.Add(Interactable);
+  UnindexedToSlot.Add(SlotIndex);
+}
+
+void UInteractionRegistrySubsystem::UnlinkBaked(uint32 SlotIndex) {
+  FSlot &Slot = GetSlot(SlotIndex);
+  if (Slot.BakedLevel != INDEX_NONE) {
+    TArray<TObjectPtr<UInteractableComponent>> &Resolved =
+        BakedLevels[Slot.BakedLevel].Resolved;
+    if (Resolved.IsValidIndex(Slot.BakedEntry)) {
+      Resolved[Slot.BakedEntry] = nullptr;
+    }
+  } else if (Slot.BakedEntry != INDEX_NONE) {
+    // Swap-remove and patch the slot of the moved entry
+    const int32 UnindexedIndex = Slot.BakedEntry;
+    const int32 LastIndex = Unindexed.Num() - 1;
+    if (UnindexedIndex != LastIndex) {
+      Unindexed[UnindexedIndex] = Unindexed[LastIndex];
+      UnindexedToSlot[UnindexedIndex] = UnindexedToSlot[LastIndex];
+      GetSlot(UnindexedToSlot[UnindexedIndex]).BakedEntry = UnindexedIndex;
+    }
+    Unindexed.RemoveAt(LastIndex, 1, EAllowShrinking::No);
+    UnindexedToSlot.RemoveAt(LastIndex, 1, EAllowShrinking::No);
+  }
+  Slot.BakedLevel = INDEX_NONE;
+  Slot.BakedEntry = INDEX_NONE;
+}
+
+void UInteractionRegistrySubsystem::DumpMemory() const {
+  struct FOwnerMemory {
+    int32 Count = 0;
+    FInteractableMemoryFootprint Footprint;
+  };
+
+  TMap<const UClass *, FOwnerMemory> ByOwnerClass;
+  FOwnerMemory Total;
+  for (const UInteractableComponent *Interactable : Interactables) {
+    const AActor *Owner = Interactable ? Interactable->GetOwner() : nullptr;
+    if (!Owner) {
+      continue;
+    }
+
+    FInteractableMemoryFootprint Footprint;
+    Interactable->AccumulateMemoryFootprint(Footprint);
+
+    FOwnerMemory &OwnerMemory = ByOwnerClass.FindOrAdd(Owner->GetClass());
+    OwnerMemory.Count++;
+    OwnerMemory.Footprint += Footprint;
+    Total.Count++;
+    Total.Footprint += Footprint;
+  }
+
+  ByOwnerClass.ValueSort([](const FOwnerMemory &A, const FOwnerMemory &B) {
+    return A.Footprint.GetTotalBytes() > B.Footprint.GetTotalBytes();
+  });
+
+  const auto LogRow = [](const FString &Name, const FOwnerMemory &Memory) {
+    const FInteractableMemoryFootprint &Footprint = Memory.Footprint;
+    UE_LOG(LogInteractionSystem, Display,
+           TEXT("%-40s %6d %10.1f %10.1f %10.1f %10.1f %10.1f %7d %7d"), *Name,
+           Memory.Count, Footprint.GetTotalBytes() / 1024.0,
+           static_cast<double>(Footprint.GetTotalBytes()) /
+               FMath::Max(1, Memory.Count),
+           static_cast<double>(Footprint.ComponentBytes) /
+               FMath::Max(1, Memory.Count),
+           static_cast<double>(Footprint.MarkerComponentBytes) /
+               FMath::Max(1, Memory.Count),
+           static_cast<double>(Footprint.WidgetBytes) /
+               FMath::Max(1, Memory.Count),
+           Footprint.NumWidgets, Footprint.NumSlateWidgets);
+  };
+
+  UE_LOG(LogInteractionSystem, Display,
+         TEXT("%-40s %6s %10s %10s %10s %10s %10s %7s %7s"), TEXT("Owner"),
+         TEXT("Count"), TEXT("TotalKB"), TEXT("AvgB"), TEXT("CompB"),
+         TEXT("MarkerB"), TEXT("UMGB"), TEXT("Widgets"), TEXT("Slate"));
+  for (const TPair<const UClass *, FOwnerMemory> &Pair : ByOwnerClass) {
+    LogRow(Pair.Key->GetName(), Pair.Value);
+  }
+  LogRow(TEXT("Total"), Total);
+  UE_LOG(LogInteractionSystem, Display,
+         TEXT("Slate widget memory is not included; see the UI tag with "
+              "-llm (stat LLMFULL)"));
+}
+
+UInteractableComponent *
+UInteractionRegistrySubsystem::Resolve(FInteractableHandle Handle) const {
+  const uint32 SlotIndex = Handle.GetIndex();
+  if (!IsValidSlot(SlotIndex)) {
+    return nullptr;
+  }
+
+  const FSlot &Slot = GetSlot(SlotIndex);
+  if (Slot.DenseIndex == INDEX_NONE ||
+      Slot.Generation != Handle.GetGeneration()) {
+    return nullptr;
+  }
+  return Interactables[Slot.DenseIndex];
+}
+
+uint32 UInteractionRegistrySubsystem::FindSlotIndex(
+    const UInteractableComponent *Interactable) const {
+  // The component caches its handle, so this is O(1) for registered entries
+  const FInteractableHandle Handle =
+      Interactable ? Interactable->GetNetHandle() : FInteractableHandle();
+  const uint32 SlotIndex = Handle.GetIndex();
+  if (IsValidSlot(SlotIndex)) {
+    const int32 DenseIndex = GetSlot(SlotIndex).DenseIndex;
+    if (DenseIndex != INDEX_NONE && Interactables[DenseIndex] == Interactable) {
+      return SlotIndex;
+    }
+  }
+  return 0;
+}
+
+void UInteractionRegistrySubsystem::ReleaseSlot(uint32 SlotIndex) {
+  UnlinkBaked(SlotIndex);
+
+  FSlot &Slot = GetSlot(SlotIndex);
+  const int32 DenseIndex = Slot.DenseIndex;
+  Slot.DenseIndex = INDEX_NONE;
+
+  // Swap-remove and patch the slot of the moved entry
+  const int32 LastIndex = Interactables.Num() - 1;
+  if (DenseIndex != LastIndex) {
+    Interactables[DenseIndex] = Interactables[LastIndex];
+    DenseToSlot[DenseIndex] = DenseToSlot[LastIndex];
+    GetSlot(DenseToSlot[DenseIndex]).DenseIndex = DenseIndex;
+  }
+  Interactables.RemoveAt(LastIndex, 1, EAllowShrinking::No);
+  DenseToSlot.RemoveAt(LastIndex, 1, EAllowShrinking::No);
+}
@@ -1,20 +1,57 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "InteractionRouter.h"
+#include "InteractableComponent.h"
+#include "InteractionProfiling.h"
 
-TScriptInterface<IInteractionRouter> FInteractionRouterRegistry::GlobalRouter;
+TMap<FObjectKey, TScriptInterface<IInteractionRouter>>
+    FInteractionRouterRegistry::Routers;
 
 void FInteractionRouterRegistry::SetRouter(
-    TScriptInterface<IInteractionRouter> InRouter) {
-  GlobalRouter = InRouter;
+    const UWorld *World, TScriptInterface<IInteractionRouter> InRouter) {
+  if (InRouter.GetInterface()) {
+    Routers.Add(FObjectKey(World), InRouter);
+  } else {
+    Routers.Remove(FObjectKey(World));
+  }
 }
 
-TScriptInterface<IInteractionRouter> FInteractionRouterRegistry::GetRouter() {
-  return GlobalRouter;
+TScriptInterface<IInteractionRouter>
+FInteractionRouterRegistry::GetRouter(const UWorld *World) {
+  const TScriptInterface<IInteractionRouter> *Router =
+      Routers.Find(FObjectKey(World));
+  return Router ? *Router : TScriptInterface<IInteractionRouter>();
 }
 
-void FInteractionRouterRegistry::Route(FInteractionEventData &EventData) {
-  if (GlobalRouter.GetInterface()) {
-    GlobalRouter->RouteInteraction(EventData);
+void FInteractionRouterRegistry::Route(FInteractionEvent &Event) {
+  CSV_SCOPED_TIMING_STAT(Interaction, Routing);
+  INTERACTION_SCOPE_CYCLE_COUNTER(STAT_InteractionRouting);
+  INC_DWORD_STAT(STAT_InteractionEventsRouted);
+  LLM_SCOPE_BYTAG(Interaction_Routing);
+
+  // Common case (one game world): no resolve needed
+  if (Routers.Num() == 1) {
+    for (TPair<FObjectKey, TScriptInterface<IInteractionRouter>> &Pair :
+         Routers) {
+      Pair.Value->RouteInteraction(Event);
+    }
+    return;
+  }
+
+  // Entity targets have no component; their instigator shares the world
+  const UObject *WorldContext = Event.ResolveTargetComponent();
+  if (!WorldContext) {
+    WorldContext = Event.ResolveInstigator();
   }
+  if (IInteractionRouter *Router =
+          WorldContext ? GetRouter(WorldContext->GetWorld()).GetInterface()
+                       : nullptr) {
+    Router->RouteInteraction(Event);
+  }
+}
+
+void FInteractionRouterRegistry::Route(FInteractionEventData &EventData) {
+  FInteractionEvent Event = FInteractionEvent::FromEventData(EventData);
+  Route(Event);
+  EventData.bHandled = Event.IsHandled();
 }
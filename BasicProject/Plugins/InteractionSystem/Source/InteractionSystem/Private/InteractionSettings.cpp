@@ -1,6 +1,16 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "InteractionSettings.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+
+namespace InteractionSettings {
+static TAutoConsoleVariable<bool> CVarForceHeadless(
+    TEXT("Interaction.ForceHeadless"), false,
+    TEXT("Skip interaction marker widgets, animation and visibility callbacks "
+         "even when rendering. Read when components begin play."));
+} // namespace InteractionSettings
 
 UInteractionSettings::UInteractionSettings() {
   // Default values are set in header via UPROPERTY defaults
@@ -9,3 +19,13 @@ UInteractionSettings::UInteractionSettings() {
 UInteractionSettings *UInteractionSettings::Get() {
   return GetMutableDefault<UInteractionSettings>();
 }
+
+bool UInteractionSettings::IsHeadless(const UWorld *World) {
+#if !INTERACTION_WITH_MARKER_UI
+  return true;
+#else
+  return InteractionSettings::CVarForceHeadless.GetValueOnGameThread() ||
+         IsRunningDedicatedServer() || !FApp::CanEverRender() ||
+         (World && World->GetNetMode() == NM_DedicatedServer);
+#endif
+}
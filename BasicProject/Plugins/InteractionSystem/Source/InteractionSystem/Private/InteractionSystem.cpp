@@ -1,15 +1,65 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "InteractionSystem.h"
+#include "InteractionProfiling.h"
+
+#if WITH_EDITOR
+#include "Engine/World.h"
+#include "InteractableIndexActor.h"
+#include "UObject/ObjectSaveContext.h"
+#endif
 
 #define LOCTEXT_NAMESPACE "FInteractionSystemModule"
 
+DEFINE_LOG_CATEGORY(LogInteractionSystem);
+CSV_DEFINE_CATEGORY_MODULE(INTERACTIONSYSTEM_API, Interaction, true);
+UE_TRACE_CHANNEL_DEFINE(InteractionChannel);
+
+LLM_DEFINE_TAG(Interaction);
+LLM_DEFINE_TAG(Interaction_Markers, TEXT("Markers"), TEXT("Interaction"));
+LLM_DEFINE_TAG(Interaction_Detection, TEXT("Detection"), TEXT("Interaction"));
+LLM_DEFINE_TAG(Interaction_Routing, TEXT("Routing"), TEXT("Interaction"));
+
+DEFINE_STAT(STAT_InteractionDetection);
+DEFINE_STAT(STAT_InteractionVisibilityDiff);
+DEFINE_STAT(STAT_InteractionMarkerAnimation);
+DEFINE_STAT(STAT_InteractionMarkerInit);
+DEFINE_STAT(STAT_InteractionRouting);
+DEFINE_STAT(STAT_InteractionHandlers);
+DEFINE_STAT(STAT_InteractionValidation);
+DEFINE_STAT(STAT_InteractionCandidatesScanned);
+DEFINE_STAT(STAT_InteractionVisibleMarkers);
+DEFINE_STAT(STAT_InteractionAnimatingMarkers);
+DEFINE_STAT(STAT_InteractionEventsRouted);
+DEFINE_STAT(STAT_InteractionMarkersInitialized);
+DEFINE_STAT(STAT_InteractionMarkersPrefetched);
+DEFINE_STAT(STAT_InteractionPrefetchHits);
+DEFINE_STAT(STAT_InteractionPrefetchMisses);
+
+#if WITH_EDITOR
+namespace InteractionSystemModule {
+/** Give every saved or cooked level with static interactables an index */
+void HandleObjectPreSave(UObject *Object, FObjectPreSaveContext SaveContext) {
+  if (const UWorld *World = Cast<UWorld>(Object)) {
+    AInteractableIndexActor::EnsureLevelIndex(World->PersistentLevel);
+  }
+}
+} // namespace InteractionSystemModule
+#endif
+
 void FInteractionSystemModule::StartupModule() {
   // This code will execute after your module is loaded into memory
+#if WITH_EDITOR
+  PreSaveHandle = FCoreUObjectDelegates::OnObjectPreSave.AddStatic(
+      &InteractionSystemModule::HandleObjectPreSave);
+#endif
 }
 
 void FInteractionSystemModule::ShutdownModule() {
   // This function may be called during shutdown to clean up your module
+#if WITH_EDITOR
+  FCoreUObjectDelegates::OnObjectPreSave.Remove(PreSaveHandle);
+#endif
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,10 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "InteractionTags.h"
+
+namespace InteractionTags {
+UE_DEFINE_GAMEPLAY_TAG_COMMENT(Interaction, "Interaction",
+                               "Root of all interaction types");
+UE_DEFINE_GAMEPLAY_TAG_COMMENT(Interaction_Default, "Interaction.Default",
+                               "Default interaction type");
+} // namespace InteractionTags
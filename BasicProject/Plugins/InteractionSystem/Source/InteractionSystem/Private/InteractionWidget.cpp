@@ -6,6 +6,7 @@
 #include "Components/Widget.h"
 #include "InteractableComponent.h"
 #include "InteractionSettings.h"
+#include "Internationalization/Internationalization.h"
 
 void UInteractionWidget::NativeConstruct() {
   Super::NativeConstruct();
@@ -15,6 +16,17 @@ void UInteractionWidget::NativeConstruct() {
     TextPanel->SetRenderOpacity(0.0f);
     TextPanel->SetVisibility(ESlateVisibility::Collapsed);
   }
+
+  bDisplayTextDirty = true;
+  CultureChangedHandle =
+      FInternationalization::Get().OnCultureChanged().AddUObject(
+          this, &UInteractionWidget::HandleDisplayTextChanged);
+}
+
+void UInteractionWidget::NativeDestruct() {
+  FInternationalization::Get().OnCultureChanged().Remove(CultureChangedHandle);
+  CultureChangedHandle.Reset();
+  Super::NativeDestruct();
 }
 
 void UInteractionWidget::NativeTick(const FGeometry &MyGeometry,
@@ -31,6 +43,11 @@ void UInteractionWidget::NativeTick(const FGeometry &MyGeometry,
 void UInteractionWidget::SetOwnerInteractable(
     UInteractableComponent *InInteractable) {
   OwnerInteractable = InInteractable;
+  bDisplayTextDirty = true;
+}
+
+void UInteractionWidget::HandleDisplayTextChanged() {
+  bDisplayTextDirty = true;
 }
 
 FText UInteractionWidget::GetDisplayText() const {
@@ -41,8 +58,7 @@ FText UInteractionWidget::GetDisplayText() const {
 }
 
 void UInteractionWidget::ShowTextPanel() {
-  TargetTextPanelOpacity = 1.0f;
-  TargetTextPanelScale = 1.0f;
+  TextPanelAnimation.SetShown(true);
   bIsTextPanelAnimating = true;
 
   if (TextPanel) {
@@ -52,11 +68,7 @@ void UInteractionWidget::ShowTextPanel() {
 
 void UInteractionWidget::HideTextPanelImmediate() {
   // Immediately hide without animation
-  TargetTextPanelOpacity = 0.0f;
-  CurrentTextPanelOpacity = 0.0f;
-  TargetTextPanelScale = 0.0f;
-  CurrentTextPanelScale = 0.0f;
-  TextPanelScaleVelocity = 0.0f;
+  TextPanelAnimation = FInteractionMarkerAnimation();
   bIsTextPanelAnimating = false;
 
   if (TextPanel) {
@@ -94,10 +106,21 @@ bool UInteractionWidget::IsCurrentTarget() const {
   return false;
 }
 
+void UInteractionWidget::PrepareForDisplay() {
+  // Runs NativeConstruct; the widget component reuses the cached Slate widget
+  TakeWidget();
+  UpdateWidgetVisuals();
+}
+
 void UInteractionWidget::UpdateWidgetVisuals_Implementation() {
-  // Update display text
-  if (TextBlock_DisplayText) {
+  // Re-apply the display text only after it changed
+  const uint16 DisplayTextSerial =
+      OwnerInteractable ? OwnerInteractable->GetDisplayTextSerial() : 0;
+  if ((bDisplayTextDirty || DisplayTextSerial != AppliedDisplayTextSerial) &&
+      TextBlock_DisplayText) {
     TextBlock_DisplayText->SetText(GetDisplayText());
+    AppliedDisplayTextSerial = DisplayTextSerial;
+    bDisplayTextDirty = false;
   }
 }
 
@@ -115,52 +138,18 @@ void UInteractionWidget::UpdateTextPanelAnimation(float DeltaTime) {
     Elasticity = Settings->DefaultAnimationElasticity;
   }
 
-  // Spring parameters for elastic scale
-  const float SpringStiffness = 300.0f;
-  const float Damping = 15.0f + (10.0f - Elasticity) * 2.0f;
-
-  // Elastic scale animation
-  const float ScaleDisplacement = TargetTextPanelScale - CurrentTextPanelScale;
-  const float SpringForce = ScaleDisplacement * SpringStiffness;
-  const float DampingForce = -TextPanelScaleVelocity * Damping;
-  const float Acceleration = SpringForce + DampingForce;
-
-  TextPanelScaleVelocity += Acceleration * DeltaTime;
-  CurrentTextPanelScale += TextPanelScaleVelocity * DeltaTime;
-  CurrentTextPanelScale = FMath::Max(0.0f, CurrentTextPanelScale);
-
-  // Linear opacity animation
-  const float FadeSpeed = FadeDuration > 0.0f ? 1.0f / FadeDuration : 100.0f;
-  if (CurrentTextPanelOpacity < TargetTextPanelOpacity) {
-    CurrentTextPanelOpacity =
-        FMath::Min(CurrentTextPanelOpacity + FadeSpeed * DeltaTime,
-                   TargetTextPanelOpacity);
-  } else if (CurrentTextPanelOpacity > TargetTextPanelOpacity) {
-    CurrentTextPanelOpacity =
-        FMath::Max(CurrentTextPanelOpacity - FadeSpeed * DeltaTime,
-                   TargetTextPanelOpacity);
-  }
+  const bool bSettled =
+      TextPanelAnimation.Step(DeltaTime, FadeDuration, Elasticity);
 
   // Apply to TextPanel
-  TextPanel->SetRenderOpacity(CurrentTextPanelOpacity);
+  TextPanel->SetRenderOpacity(TextPanelAnimation.Opacity);
   TextPanel->SetRenderScale(
-      FVector2D(CurrentTextPanelScale, CurrentTextPanelScale));
-
-  // Check if animation complete
-  const bool bScaleSettled =
-      FMath::IsNearlyEqual(CurrentTextPanelScale, TargetTextPanelScale,
-                           0.01f) &&
-      FMath::Abs(TextPanelScaleVelocity) < 0.1f;
-  const bool bOpacitySettled = FMath::IsNearlyEqual(
-      CurrentTextPanelOpacity, TargetTextPanelOpacity, 0.01f);
-
-  if (bScaleSettled && bOpacitySettled) {
-    CurrentTextPanelOpacity = TargetTextPanelOpacity;
-    CurrentTextPanelScale = TargetTextPanelScale;
-    TextPanelScaleVelocity = 0.0f;
+      FVector2D(TextPanelAnimation.Scale, TextPanelAnimation.Scale));
+
+  if (bSettled) {
     bIsTextPanelAnimating = false;
 
-    if (TargetTextPanelOpacity == 0.0f) {
+    if (TextPanelAnimation.IsHiding()) {
       TextPanel->SetVisibility(ESlateVisibility::Collapsed);
     }
   }
@@ -4,20 +4,78 @@
 
 #include "Components/ActorComponent.h"
 #include "CoreMinimal.h"
+#include "InteractionEvent.h"
+#include "InteractionMarkerAnimation.h"
 #include "InteractionTypes.h"
 #include "InteractableComponent.generated.h"
 
 
+class UInteractableDefinition;
 class UWidgetComponent;
+struct FInteractableMemoryFootprint;
 class UInteractionWidget;
 
+/**
+ * Values one interactable overrides on top of its definition
+ * Components hold at most one of these, and none at all when every value
+ * comes from the definition.
+ *
+ * 인스턴스가 정의 위에 재정의한 값 (재정의가 없으면 저장하지 않음)
+ */
+USTRUCT()
+struct FInteractableOverrides {
+  GENERATED_BODY()
+
+  UPROPERTY()
+  bool bHasInteractionType = false;
+
+  UPROPERTY()
+  bool bHasDisplayText = false;
+
+  UPROPERTY()
+  bool bHasMarkerOffset = false;
+
+  UPROPERTY()
+  FGameplayTag InteractionType;
+
+  UPROPERTY()
+  FText DisplayText;
+
+  UPROPERTY()
+  FVector MarkerOffset = FVector::ZeroVector;
+};
+
+/**
+ * Display text arguments and the formatted text cache, only allocated once a
+ * component sets its first display text argument (static labels never pay
+ * for it)
+ */
+struct FInteractableDisplayTextFormat {
+  /** Named arguments for the display text pattern */
+  FFormatNamedArguments Arguments;
+
+  /** Cache for GetDisplayText: the pattern it was compiled from, the compiled
+   * format, the formatted result and the text revision it was built at
+   * (changes with the culture) */
+  FText Pattern;
+  FTextFormat Format;
+  FText Text;
+  uint16 TextRevision = 0;
+  bool bDirty = true;
+};
+
 /**
  * Component that makes any actor interactable
  * Attach this to any actor to enable interaction functionality
  * Creates a WidgetComponent for world-space marker display
+ * (skipped on headless servers, which only register for detection)
+ * Shared values come from Definition; only overridden values are stored per
+ * instance, in a sparse FInteractableOverrides
  *
  * 아무 액터에나 부착하여 상호작용 가능하게 만드는 컴포넌트
  * 월드 스페이스 마커 표시를 위한 WidgetComponent 생성
+ * (헤드리스 서버에서는 생략하고 탐지용 등록만 수행)
+ * 공유 값은 Definition에서, 재정의한 값만 인스턴스별로 희소하게 저장
  */
 UCLASS(ClassGroup = (Interaction), meta = (BlueprintSpawnableComponent))
 class INTERACTIONSYSTEM_API UInteractableComponent : public UActorComponent {
@@ -32,8 +90,19 @@ public:
   virtual void
   TickComponent(float DeltaTime, ELevelTick TickType,
                 FActorComponentTickFunction *ThisTickFunction) override;
+  virtual void GetLifetimeReplicatedProps(
+      TArray<FLifetimeProperty> &OutLifetimeProps) const override;
   //~ End UActorComponent Interface
 
+  //~ Begin UObject Interface
+  virtual void PostLoad() override;
+#if WITH_EDITOR
+  virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+  virtual void
+  PostEditChangeProperty(FPropertyChangedEvent &PropertyChangedEvent) override;
+#endif
+  //~ End UObject Interface
+
   /**
    * Attempt to interact with this component
    * Called by InteractionDetectorComponent when player triggers interaction
@@ -41,68 +110,239 @@ public:
   UFUNCTION(BlueprintCallable, Category = "Interaction")
   void TryInteract(AActor *InteractionInstigator);
 
-  /** Get the display text for UI */
+  /**
+   * Get the display text for UI (override or definition)
+   * With display text arguments set, the text is a format pattern such as
+   * "Open {DoorName}"; the formatted result is cached and only rebuilt after
+   * an argument, the pattern or the culture changed
+   */
+  UFUNCTION(BlueprintPure, Category = "Interaction")
+  FText GetDisplayText() const;
+
+  /** Set a named argument of the display text pattern (local, not replicated;
+   * no-op if the text's content is unchanged) */
+  UFUNCTION(BlueprintCallable, Category = "Interaction")
+  void SetDisplayTextArgument(FName ArgumentName, const FText &Value);
+
+  /** Set a numeric named argument of the display text pattern (e.g. {Count}) */
+  UFUNCTION(BlueprintCallable, Category = "Interaction")
+  void SetDisplayTextArgumentInt(FName ArgumentName, int32 Value);
+
+  /** Bumped whenever the display text may have changed (pattern, definition
+   * or an argument); markers re-apply their text only when it moves */
+  uint16 GetDisplayTextSerial() const { return DisplayTextSerial; }
+
+  /** Get the interaction type (override or definition) */
   UFUNCTION(BlueprintPure, Category = "Interaction")
-  FText GetDisplayText() const { return DisplayText; }
+  FGameplayTag GetInteractionType() const;
+
+  /** Get the marker offset (override or definition) */
+  UFUNCTION(BlueprintPure, Category = "Interaction")
+  FVector GetMarkerOffset() const;
+
+  /** Get the shared definition (may be null) */
+  UFUNCTION(BlueprintPure, Category = "Interaction")
+  const UInteractableDefinition *GetDefinition() const { return Definition; }
+
+  /** Change the shared definition (replicated, marks dirty only on change) */
+  UFUNCTION(BlueprintCallable, Category = "Interaction")
+  void SetDefinition(const UInteractableDefinition *NewDefinition);
+
+  /** Get the compact interaction type id (cached, follows InteractionType) */
+  FInteractionTypeId GetInteractionTypeId() const;
 
-  /** Get the interaction type */
+  /** Get the registry handle used to address this component over the network */
   UFUNCTION(BlueprintPure, Category = "Interaction")
-  FName GetInteractionType() const { return InteractionType; }
+  FInteractableHandle GetNetHandle() const { return NetHandle; }
 
   /** Check if interaction is currently possible */
   UFUNCTION(BlueprintPure, Category = "Interaction")
   bool CanInteract() const { return bCanInteract; }
 
-  /** Enable or disable interaction */
+  /** Enable or disable interaction (replicated, marks dirty only on change) */
   UFUNCTION(BlueprintCallable, Category = "Interaction")
   void SetCanInteract(bool bNewCanInteract);
 
+  /** Override the display text (replicated, marks dirty only on change) */
+  UFUNCTION(BlueprintCallable, Category = "Interaction")
+  void SetDisplayText(const FText &NewDisplayText);
+
+  /** Override the interaction type (replicated, marks dirty only on change) */
+  UFUNCTION(BlueprintCallable, Category = "Interaction")
+  void SetInteractionType(FGameplayTag NewInteractionType);
+
+  /** Override the marker offset (replicated with the other overrides) */
+  UFUNCTION(BlueprintCallable, Category = "Interaction")
+  void SetMarkerOffset(const FVector &NewMarkerOffset);
+
   //~ Visibility state management (called by InteractionDetectorComponent)
+  //~ Each marker-driving detector owns one viewer bit; the single marker shows
+  //~ while any viewer sees it, the text panel while any viewer targets it
 
-  /** Set visibility state (within visibility radius) */
-  void SetVisible(bool bNewVisible);
+  /** Set visibility for one viewer (within its visibility radius) */
+  void SetVisible(int32 ViewerIndex, bool bNewVisible);
 
-  /** Set interactable state (within interaction radius + is current target) */
-  void SetInteractable(bool bNewInteractable);
+  /** Set target state for one viewer (within its interaction radius + is its
+   * current target) */
+  void SetInteractable(int32 ViewerIndex, bool bNewInteractable);
 
   /** Get current marker opacity (for animation) */
   UFUNCTION(BlueprintPure, Category = "Interaction")
-  float GetMarkerOpacity() const { return CurrentMarkerOpacity; }
+  float GetMarkerOpacity() const { return MarkerAnimation.Opacity; }
 
-  /** Check if marker is visible */
+  /** Check if marker is visible to any viewer */
   UFUNCTION(BlueprintPure, Category = "Interaction")
-  bool IsMarkerVisible() const { return bIsVisible; }
+  bool IsMarkerVisible() const { return VisibleViewers != 0; }
 
-  /** Check if this is the current interaction target */
+  /** Check if this is any viewer's current interaction target */
   UFUNCTION(BlueprintPure, Category = "Interaction")
-  bool IsCurrentTarget() const { return bIsInteractable; }
+  bool IsCurrentTarget() const { return TargetViewers != 0; }
+
+  /** Check if one viewer (see UInteractionDetectorComponent::GetViewerIndex)
+   * sees the marker */
+  UFUNCTION(BlueprintPure, Category = "Interaction")
+  bool IsVisibleTo(int32 ViewerIndex) const {
+    return ViewerIndex >= 0 && ViewerIndex < 32 &&
+           (VisibleViewers & (1u << ViewerIndex)) != 0;
+  }
+
+  /** Check if this is one viewer's current interaction target */
+  UFUNCTION(BlueprintPure, Category = "Interaction")
+  bool IsTargetOf(int32 ViewerIndex) const {
+    return ViewerIndex >= 0 && ViewerIndex < 32 &&
+           (TargetViewers & (1u << ViewerIndex)) != 0;
+  }
+
+  /**
+   * Create the marker widget component (registration, widget construction).
+   * Queued by BeginPlay under the settings' marker init budget, which loads
+   * the widget class asynchronously first; until it runs the interactable
+   * works without a marker. Unqueued markers load the class here.
+   */
+  void CreateMarker();
+
+  /** Marker widget class of the definition, else the settings default */
+  const TSoftClassPtr<UUserWidget> &GetMarkerWidgetClassPath() const;
+
+  /**
+   * Prepare the marker before it is first shown: build its Slate widget and
+   * set its text, creating the marker first if it is still queued. Called
+   * ahead of time by the detector's prefetch, otherwise on the frame the
+   * marker becomes visible.
+   * @return true if there was work to do
+   */
+  bool PrepareMarker();
+
+  /** Check if the marker has been prepared (see PrepareMarker) */
+  bool IsMarkerPrepared() const { return bMarkerPrepared; }
+
+  /** Check if the marker has ever been shown */
+  bool WasMarkerShown() const { return bMarkerShown; }
+
+  /** Add this component's memory, including its marker UI, to OutFootprint */
+  void AccumulateMemoryFootprint(FInteractableMemoryFootprint &OutFootprint) const;
+
+  //~ Client prediction (called by InteractionDetectorComponent)
+
+  /** Mark as used by a pending predicted interaction and fire OnInteractPredicted */
+  void BeginPredictedUse(AActor *InteractionInstigator);
+
+  /** Clear the predicted use; rejected codes fire OnPredictionRolledBack */
+  void EndPredictedUse(EInteractionResultCode Code);
+
+  /** Check if a predicted interaction is waiting for the server */
+  UFUNCTION(BlueprintPure, Category = "Interaction")
+  bool IsPredictedUse() const { return PredictedUseCount > 0; }
 
 public:
-  /** Identifier for the type of interaction */
-  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction")
-  FName InteractionType = TEXT("Default");
+  /**
+   * Shared data for this kind of interactable (type, text, marker, radii)
+   * Replicated (push model): change at runtime through SetDefinition
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly,
+            ReplicatedUsing = OnRep_Overrides,
+            BlueprintSetter = SetDefinition, Category = "Interaction")
+  TObjectPtr<const UInteractableDefinition> Definition;
 
-  /** Text displayed in the interaction widget */
-  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction")
+#if WITH_EDITORONLY_DATA
+  //~ Authoring values, baked into Overrides on load, edit and save. With a
+  //~ Definition only the toggled ones are kept; without one, every value that
+  //~ differs from the default is.
+
+  UPROPERTY(EditAnywhere, Category = "Interaction",
+            meta = (EditCondition = "Definition != nullptr"))
+  uint8 bOverride_InteractionType : 1;
+
+  UPROPERTY(EditAnywhere, Category = "Interaction",
+            meta = (EditCondition = "Definition != nullptr"))
+  uint8 bOverride_DisplayText : 1;
+
+  UPROPERTY(EditAnywhere, Category = "Interaction|UI",
+            meta = (EditCondition = "Definition != nullptr"))
+  uint8 bOverride_MarkerOffset : 1;
+
+  /**
+   * Type of interaction, hierarchical (e.g., Interaction.Door, Interaction.Loot.Chest)
+   * Assets saved with the old FName type load as the tag of the same name
+   * Read through GetInteractionType, change at runtime through
+   * SetInteractionType
+   */
+  UPROPERTY(EditAnywhere, Category = "Interaction",
+            meta = (Categories = "Interaction",
+                    EditCondition =
+                        "bOverride_InteractionType || Definition == nullptr"))
+  FGameplayTag InteractionType;
+
+  /** Text displayed in the interaction widget
+   * Read through GetDisplayText, change at runtime through SetDisplayText */
+  UPROPERTY(EditAnywhere, Category = "Interaction",
+            meta = (EditCondition =
+                        "bOverride_DisplayText || Definition == nullptr"))
   FText DisplayText = NSLOCTEXT("Interaction", "DefaultText", "Interact");
+#endif
 
   /** If true, processes interaction locally via OnInteractLocal delegate (DEBUG
    * ONLY) */
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction")
   bool bHandleLocally = false;
 
-  /** Whether this component can currently be interacted with */
-  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction")
+  /** Whether this component can currently be interacted with (replicated,
+   * see SetCanInteract) */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Replicated,
+            BlueprintSetter = SetCanInteract, Category = "Interaction")
   bool bCanInteract = true;
 
-  /** Offset for the marker widget position (relative to actor) */
-  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction|UI")
+  /**
+   * Put the replicated owner to sleep (DORM_DormantAll) after its initial
+   * bunch. Only enable on owners that replicate nothing but interaction
+   * state: static interactables then cost nothing per connection, and state
+   * changes flush dormancy for one update.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Interaction|Networking")
+  bool bAllowNetDormancy = false;
+
+#if WITH_EDITORONLY_DATA
+  /** Offset for the marker widget position (relative to actor)
+   * Read through GetMarkerOffset, change at runtime through SetMarkerOffset */
+  UPROPERTY(EditAnywhere, Category = "Interaction|UI",
+            meta = (EditCondition =
+                        "bOverride_MarkerOffset || Definition == nullptr"))
   FVector MarkerOffset = FVector(0.0f, 0.0f, 100.0f);
+#endif
 
   /** Called when interaction occurs and bHandleLocally is true */
   UPROPERTY(BlueprintAssignable, Category = "Interaction|Events")
   FOnInteractLocal OnInteractLocal;
 
+  /** Called on the requesting client as soon as it predicts an interaction */
+  UPROPERTY(BlueprintAssignable, Category = "Interaction|Events")
+  FOnInteractPredicted OnInteractPredicted;
+
+  /** Called on the requesting client when the server rejects a prediction or
+   * it times out; undo what OnInteractPredicted applied */
+  UPROPERTY(BlueprintAssignable, Category = "Interaction|Events")
+  FOnInteractionPredictionRolledBack OnPredictionRolledBack;
+
   /** Global delegate for interaction events */
   static FOnInteractionEvent OnInteractionEvent;
 
@@ -111,23 +351,102 @@ protected:
   UPROPERTY()
   TObjectPtr<UWidgetComponent> MarkerWidgetComponent;
 
-  /** Current visibility state (within visibility radius) */
-  bool bIsVisible = false;
+  /** Marker UI is skipped (server/-nullrhi, see UInteractionSettings::IsHeadless) */
+  bool bHeadless = false;
 
-  /** Current interactable state (current target) */
-  bool bIsInteractable = false;
+  /** Viewers whose visibility radius contains this (bit per viewer index) */
+  uint32 VisibleViewers = 0;
+
+  /** Viewers targeting this (always a subset of VisibleViewers) */
+  uint32 TargetViewers = 0;
+
+  /** Marker warm-up state, see CreateMarker and PrepareMarker */
+  bool bMarkerCreated = false;
+  bool bMarkerQueued = false;
+  bool bMarkerPrepared = false;
+  bool bMarkerShown = false;
 
   /** Animation state */
-  float CurrentMarkerOpacity = 0.0f;
-  float TargetMarkerOpacity = 0.0f;
-  float MarkerScaleVelocity = 0.0f;
-  float CurrentMarkerScale = 0.0f;
-  float TargetMarkerScale = 0.0f;
+  FInteractionMarkerAnimation MarkerAnimation;
   bool bIsAnimating = false;
 
+  /** Pending predicted interactions targeting this component (client) */
+  int32 PredictedUseCount = 0;
+
   /** Update marker animation */
   void UpdateMarkerAnimation(float DeltaTime);
 
-  /** Internal function to build event data */
-  FInteractionEventData BuildEventData(AActor *InteractionInstigator) const;
+  /** Apply marker and text panel changes after the viewer masks changed */
+  void ApplyViewerMasks(uint32 OldVisibleViewers, uint32 OldTargetViewers);
+
+  /** Split-screen: hide the marker in local viewports whose viewer does not
+   * see it (one shared widget renders in every viewport otherwise) */
+  void UpdateViewportHiding();
+
+  /** Drop the marker from every local player's hidden list (it is going away) */
+  void ClearViewportHiding();
+
+  /** Wake a dormant owner for one update; setters call this before writing
+   * so the change is compared against the state the clients last received */
+  void FlushReplicatedState();
+
+  /** Definition or overrides replicated: let markers pick up the new text
+   * and offset */
+  UFUNCTION()
+  void OnRep_Overrides();
+
+  /** Move the marker to GetMarkerOffset (if it exists) */
+  void ApplyMarkerOffset();
+
+  /** Drop the cached display text and bump the serial markers watch */
+  void InvalidateDisplayText();
+
+  /** Register the server-issued handle with the client registry */
+  UFUNCTION()
+  void OnRep_NetHandle(FInteractableHandle PreviousHandle);
+
+  /** Registry handle, assigned by the server and sent once on spawn */
+  UPROPERTY(ReplicatedUsing = OnRep_NetHandle)
+  FInteractableHandle NetHandle;
+
+  /** Internal function to build the compact event */
+  FInteractionEvent BuildEvent(AActor *InteractionInstigator) const;
+
+private:
+  /**
+   * Instance overrides, empty unless something is overridden (sparse: an
+   * instance that only uses its definition pays for an empty array)
+   * Replicated (push model) through the Set* functions
+   */
+  UPROPERTY(ReplicatedUsing = OnRep_Overrides)
+  TArray<FInteractableOverrides> Overrides;
+
+  /** The overrides, or null when there are none */
+  const FInteractableOverrides *GetOverrides() const {
+    return Overrides.IsEmpty() ? nullptr : &Overrides[0];
+  }
+
+  /** The overrides, added on first use */
+  FInteractableOverrides &GetOrAddOverrides() {
+    return Overrides.IsEmpty() ? Overrides.AddDefaulted_GetRef() : Overrides[0];
+  }
+
+#if WITH_EDITORONLY_DATA
+  /** Rebuild Overrides from the authoring values */
+  void BakeOverrides();
+#endif
+
+  /** Store a named argument, invalidating the cached text if it changed */
+  void SetDisplayTextArgumentValue(FName ArgumentName,
+                                   FFormatArgumentValue &&Value);
+
+  /** Type id cache for GetInteractionTypeId */
+  mutable FGameplayTag CachedTypeTag;
+  mutable FInteractionTypeId CachedTypeId = 0;
+
+  /** Display text arguments and cache (null = static text) */
+  TUniquePtr<FInteractableDisplayTextFormat> DisplayTextFormat;
+
+  /** See GetDisplayTextSerial */
+  uint16 DisplayTextSerial = 0;
 };
@@ -0,0 +1,68 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GameplayTagContainer.h"
+#include "InteractableDefinition.generated.h"
+
+class UUserWidget;
+
+/**
+ * Shared, immutable data for one kind of interactable (crate, door, ...)
+ * Components reference a definition and only store the values they override,
+ * so thousands of identical instances share one text, type and marker setup.
+ *
+ * 한 종류의 상호작용 대상이 공유하는 불변 데이터 (플라이웨이트)
+ * 컴포넌트는 정의를 참조하고 재정의한 값만 저장합니다.
+ */
+UCLASS(BlueprintType)
+class INTERACTIONSYSTEM_API UInteractableDefinition : public UPrimaryDataAsset {
+  GENERATED_BODY()
+
+public:
+  /** Type of interaction (e.g., Interaction.Door) */
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interaction",
+            meta = (Categories = "Interaction"))
+  FGameplayTag InteractionType;
+
+  /** Text displayed in the interaction widget */
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interaction")
+  FText DisplayText = NSLOCTEXT("Interaction", "DefaultText", "Interact");
+
+  /** Offset for the marker widget position (relative to actor) */
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interaction|UI")
+  FVector MarkerOffset = FVector(0.0f, 0.0f, 100.0f);
+
+  /** Marker widget for this kind (empty = settings DefaultWidgetClass) */
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interaction|UI")
+  TSoftClassPtr<UUserWidget> MarkerWidgetClass;
+
+  /** Visibility radius for this kind in cm (0 = detector's VisibilityRadius) */
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly,
+            Category = "Interaction|Detection", meta = (ClampMin = "0.0"))
+  float VisibilityRadius = 0.0f;
+
+  /** Interaction radius for this kind in cm (0 = detector's InteractionRadius) */
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly,
+            Category = "Interaction|Detection", meta = (ClampMin = "0.0"))
+  float InteractionRadius = 0.0f;
+
+  /** Visibility radius for a definition (null or 0 = DetectorRadius) */
+  static float ResolveVisibilityRadius(const UInteractableDefinition *Definition,
+                                       float DetectorRadius) {
+    return Definition && Definition->VisibilityRadius > 0.0f
+               ? Definition->VisibilityRadius
+               : DetectorRadius;
+  }
+
+  /** Interaction radius for a definition (null or 0 = DetectorRadius) */
+  static float
+  ResolveInteractionRadius(const UInteractableDefinition *Definition,
+                           float DetectorRadius) {
+    return Definition && Definition->InteractionRadius > 0.0f
+               ? Definition->InteractionRadius
+               : DetectorRadius;
+  }
+};
@@ -0,0 +1,137 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Info.h"
+#include "InteractableIndexActor.generated.h"
+
+class UInteractableComponent;
+class UInteractableDefinition;
+
+/** One static interactable baked into a level's index */
+USTRUCT()
+struct INTERACTIONSYSTEM_API FInteractableIndexEntry {
+  GENERATED_BODY()
+
+  /** Owner actor location at bake time, relative to the index actor (moves
+   * with level instances and streaming level transforms) */
+  UPROPERTY(VisibleAnywhere, Category = "Interaction")
+  FVector3f Location = FVector3f::ZeroVector;
+
+  /** Shared definition (may be null) */
+  UPROPERTY(VisibleAnywhere, Category = "Interaction")
+  TObjectPtr<const UInteractableDefinition> Definition;
+
+  /** Path of the component; resolves once its level is loaded */
+  UPROPERTY(VisibleAnywhere, Category = "Interaction")
+  TSoftObjectPtr<UInteractableComponent> Component;
+};
+
+/** Run of entries sharing one grid cell */
+USTRUCT()
+struct INTERACTIONSYSTEM_API FInteractableIndexCell {
+  GENERATED_BODY()
+
+  /** Biased cell X in the high 32 bits, cell Y in the low 32 bits */
+  UPROPERTY()
+  uint64 Key = 0;
+
+  UPROPERTY()
+  int32 FirstEntry = 0;
+
+  UPROPERTY()
+  int32 NumEntries = 0;
+};
+
+/**
+ * Spatial index of a level's static interactables, rebuilt in the editor
+ * whenever the level is saved or cooked. Entries are sorted by grid cell and
+ * load as two flat arrays with the level, so the registry can answer spatial
+ * queries on the first frame, before the indexed actors begin play. Once an
+ * indexed interactable registers, detectors find it through the grid instead
+ * of scanning it every update.
+ * Locations are stored relative to this actor, so the index follows the
+ * level's transform (level instances, streaming offsets).
+ * Created on save for every level holding a static interactable (non World
+ * Partition; only loaded actors are indexed).
+ *
+ * 레벨의 정적 상호작용 대상 공간 인덱스 - 저장/쿡 시 에디터에서 재구성
+ * 그리드 셀 순으로 정렬된 평면 배열로 레벨과 함께 로드되어, 액터의
+ * BeginPlay 이전인 첫 프레임부터 레지스트리에서 공간 질의 가능
+ * 등록된 대상은 탐지기가 전체 순회 대신 그리드로 찾음
+ * 위치는 이 액터 기준 상대 좌표 - 레벨 인스턴스/스트리밍 변환을 따름
+ */
+UCLASS(NotBlueprintable)
+class INTERACTIONSYSTEM_API AInteractableIndexActor : public AInfo {
+  GENERATED_BODY()
+
+public:
+  AInteractableIndexActor();
+
+  //~ Begin AActor Interface
+  virtual void PostInitializeComponents() override;
+  virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+  //~ End AActor Interface
+
+#if WITH_EDITOR
+  //~ Begin UObject Interface
+  virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+  //~ End UObject Interface
+
+  /** Rebuild the index from the interactables placed in this level */
+  UFUNCTION(CallInEditor, Category = "Interaction")
+  void RebuildIndex();
+
+  /** Spawn and build the index of a level that holds static interactables
+   * but has none yet (an existing index rebuilds itself in PreSave) */
+  static void EnsureLevelIndex(ULevel *Level);
+#endif
+
+  /**
+   * Visit the entries within Radius of Origin
+   * @param Origin Location relative to this actor (see GetActorTransform)
+   */
+  void QueryLocal(const FVector &Origin, float Radius,
+                  TFunctionRef<void(int32 EntryIndex)> Visit) const;
+
+  /** Entry index of an interactable baked at a location relative to this
+   * actor (INDEX_NONE if it was not indexed there) */
+  int32 FindEntry(const FVector &Location,
+                  const UInteractableComponent *Interactable) const;
+
+  /** Number of baked interactables */
+  int32 Num() const { return Entries.Num(); }
+
+  const TArray<FInteractableIndexEntry> &GetEntries() const { return Entries; }
+
+protected:
+  /** Grid cell size in cm; queries visit every cell the radius overlaps */
+  UPROPERTY(EditAnywhere, Category = "Interaction", meta = (ClampMin = "100.0"))
+  float CellSize = 1000.0f;
+
+private:
+  /** Whether an actor's interactables stay in their baked cell */
+  static bool IsIndexable(const AActor *Actor);
+
+  /** Key of the cell containing a location relative to this actor */
+  uint64 GetCellKey(const FVector &Location) const {
+    return GetCellKey(FMath::FloorToInt32(Location.X / CellSize),
+                      FMath::FloorToInt32(Location.Y / CellSize));
+  }
+
+  /** Key of a cell; coordinates are biased so keys sort like (X, Y) */
+  static uint64 GetCellKey(int32 CellX, int32 CellY) {
+    return (static_cast<uint64>(static_cast<uint32>(CellX) ^ 0x80000000u)
+            << 32) |
+           (static_cast<uint32>(CellY) ^ 0x80000000u);
+  }
+
+  /** Entries sorted by cell key */
+  UPROPERTY(VisibleAnywhere, Category = "Interaction")
+  TArray<FInteractableIndexEntry> Entries;
+
+  /** Non-empty cells sorted by key */
+  UPROPERTY()
+  TArray<FInteractableIndexCell> Cells;
+};
@@ -4,11 +4,31 @@
 
 #include "Components/ActorComponent.h"
 #include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "InteractionEvent.h"
 #include "InteractionTypes.h"
 #include "InteractionDetectorComponent.generated.h"
 
+class AController;
+class APawn;
+class APlayerController;
 class UInteractableComponent;
 
+/**
+ * Nearest interactable found outside the component registry by a batch pass
+ * (e.g. a MassEntity interactable), written once per frame
+ *
+ * 컴포넌트 레지스트리 외부(예: MassEntity)에서 찾은 가장 가까운 상호작용 대상
+ */
+struct FInteractionExternalTarget {
+  /** Packed entity handle (0 = none) */
+  uint64 EntityId = 0;
+  FInteractionTypeId TypeId = 0;
+  float DistanceSq = 0.0f;
+
+  bool IsValid() const { return EntityId != 0; }
+};
+
 /**
  * Component that detects nearby interactable objects and manages
  * visibility/interaction states Attach this to the player character/pawn
@@ -32,7 +52,12 @@ public:
   virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
   //~ End UActorComponent Interface
 
-  /** Attempt to interact with the current target */
+  /**
+   * Attempt to interact with the current target
+   * With authority the interaction runs directly; on a client a compact
+   * request is sent to the server, which validates and answers in a batch.
+   * Clients predict the interaction meanwhile and roll it back if rejected.
+   */
   UFUNCTION(BlueprintCallable, Category = "Interaction")
   void TryInteract();
 
@@ -40,14 +65,59 @@ public:
   UFUNCTION(BlueprintPure, Category = "Interaction")
   UInteractableComponent *GetCurrentTarget() const { return CurrentTarget; }
 
-  /** Check if there is a valid interaction target */
+  /** Check if there is a valid interaction target (entity targets count only
+   * with authority, the only place TryInteract uses them) */
   UFUNCTION(BlueprintPure, Category = "Interaction")
-  bool HasValidTarget() const { return CurrentTarget != nullptr; }
+  bool HasValidTarget() const;
+
+  /** Set the nearest non-component target (authority interacts with it when
+   * it is nearer than the component target) */
+  void SetExternalTarget(const FInteractionExternalTarget &NewTarget) {
+    ExternalTarget = NewTarget;
+  }
+
+  const FInteractionExternalTarget &GetExternalTarget() const {
+    return ExternalTarget;
+  }
+
+  /** Compiled TypeFilter, for batch passes matching on behalf of this detector */
+  const FInteractionTypeFilter &GetCompiledTypeFilter() const {
+    return CompiledTypeFilter;
+  }
+
+  /** Interactables within VisibilityRadius after the last update (empty
+   * without a viewer bit unless bAlwaysTrackVisibleSet is set) */
+  const TArray<TObjectPtr<UInteractableComponent>> &
+  GetVisibleInteractables() const {
+    return VisibleInteractables;
+  }
+
+  /** Bit of this detector in the interactables' viewer masks (INDEX_NONE when
+   * headless, not locally controlled or out of viewer bits: targets are still
+   * picked, markers are not driven) */
+  int32 GetViewerIndex() const { return ViewerIndex; }
+
+  /** Local player controller whose viewport this detector drives (or null) */
+  APlayerController *GetLocalViewer() const;
 
   /** Manually trigger a detection update */
   UFUNCTION(BlueprintCallable, Category = "Interaction")
   void ForceUpdateDetection();
 
+  /** Replace the type filter (empty query = detect every type) */
+  UFUNCTION(BlueprintCallable, Category = "Interaction")
+  void SetTypeFilter(const FGameplayTagQuery &NewTypeFilter);
+
+  /** Client prediction counters, including the perceived latency saved */
+  UFUNCTION(BlueprintPure, Category = "Interaction")
+  FInteractionPredictionStats GetPredictionStats() const {
+    return PredictionStats;
+  }
+
+  /** Marker prefetch counters (hit = prepared before first shown) */
+  UFUNCTION(BlueprintPure, Category = "Interaction")
+  FInteractionPrefetchStats GetPrefetchStats() const { return PrefetchStats; }
+
 public:
   /** Radius for visibility (marker appears) in cm */
   UPROPERTY(EditAnywhere, BlueprintReadWrite,
@@ -64,6 +134,38 @@ public:
             Category = "Interaction|Detection", meta = (ClampMin = "0.0"))
   float DetectionInterval = 0.1f;
 
+  /**
+   * Seconds of owner movement to look ahead when preparing markers (0 = off)
+   * Markers whose visibility ring the owner's extrapolated path enters within
+   * this time are prepared before they show, so a sprint across many markers
+   * does not build their widgets all on one frame
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "Interaction|Detection", meta = (ClampMin = "0.0"))
+  float PrefetchHorizon = 0.5f;
+
+  /** Markers prepared per detection update at most (spreads the work) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "Interaction|Detection", meta = (ClampMin = "1"))
+  int32 MaxPrefetchesPerUpdate = 2;
+
+  /**
+   * Only detect interactables whose type matches this query (empty = all)
+   * Compiled to a type id bitmask, so filtering is a bit test per candidate
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Interaction|Detection",
+            meta = (Categories = "Interaction"))
+  FGameplayTagQuery TypeFilter;
+
+  /**
+   * Keep GetVisibleInteractables up to date without a viewer bit (headless,
+   * not locally controlled), e.g. for AI or tests reading the visible set
+   * Markers are still only driven for local viewers.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "Interaction|Detection", AdvancedDisplay)
+  bool bAlwaysTrackVisibleSet = false;
+
   /** Draw debug circles for visibility/interaction radius */
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction|Debug")
   bool bDrawDebug = false;
@@ -72,22 +174,135 @@ public:
   UPROPERTY(BlueprintAssignable, Category = "Interaction|Events")
   FOnInteractionTargetChanged OnTargetChanged;
 
+  /** Called on the owning client for each server result of its requests */
+  UPROPERTY(BlueprintAssignable, Category = "Interaction|Events")
+  FOnInteractionResult OnInteractionResult;
+
 protected:
+  /**
+   * Client -> server interaction request
+   * @param Target Registry handle of the interactable
+   * @param ClientTimeSeconds Synced server world time when the client pressed
+   * @param RequestId Client sequence number echoed in the result
+   */
+  UFUNCTION(Server, Reliable)
+  void ServerRequestInteract(FInteractableHandle Target,
+                             float ClientTimeSeconds, uint16 RequestId);
+
+  /** Server -> owning client batch of results for one net update */
+  UFUNCTION(Client, Reliable)
+  void ClientReceiveResults(const TArray<FInteractionResult> &Results);
+
+  /** Whether TryInteract routes the entity target: it has authority and the
+   * entity is nearer than the component target */
+  bool ShouldUseExternalTarget() const;
+
+  /** Validate a request on the server (O(1) handle lookup, no world scan) */
+  EInteractionResultCode ValidateRequest(UInteractableComponent *Target,
+                                         float ClientTimeSeconds);
+
+  /** Consume a rate limit token (server) */
+  bool ConsumeRequestToken();
+
+  /** Send queued results if the owner's net update interval has elapsed */
+  void FlushPendingResults(bool bForce);
+
+  /** Synced server world time */
+  float GetServerTimeSeconds() const;
+
+  /** Apply a predicted interaction locally, keyed by its request id (client) */
+  void PredictInteraction(uint16 RequestId, UInteractableComponent *Target);
+
+  /** Confirm or roll back a pending prediction and update the stats */
+  void ResolvePrediction(int32 Index, EInteractionResultCode Code,
+                         bool bTimedOut);
+
+  /** Roll back predictions the server has not answered in time */
+  void ExpirePredictions();
+
   /** Update visibility and interaction states for all interactables */
   void UpdateInteractables();
 
+  /** Count a marker's first show as a prefetch hit or miss */
+  void RecordPrefetchResult(bool bHit);
+
   /** Set the current target and fire events */
   void SetCurrentTarget(UInteractableComponent *NewTarget);
 
+  /** Hold a viewer bit only while a local player controls the owner (remote
+   * pawns, bots and walkers would otherwise use up the MaxViewers bits) */
+  void UpdateViewerIndex();
+
+  /** Give the viewer bit back and clear it on the interactables it drives */
+  void ReleaseViewerIndex();
+
+  /** Owner pawn was possessed or unpossessed */
+  UFUNCTION()
+  void HandleControllerChanged(APawn *Pawn, AController *OldController,
+                               AController *NewController);
+
 private:
   /** Currently targeted interactable (within InteractionRadius) */
   UPROPERTY()
   TObjectPtr<UInteractableComponent> CurrentTarget;
 
+  /** Squared distance to CurrentTarget at the last detection update */
+  float CurrentTargetDistanceSq = 0.0f;
+
+  /** Nearest entity target from a batch pass */
+  FInteractionExternalTarget ExternalTarget;
+
   /** All currently visible interactables (within VisibilityRadius) */
   UPROPERTY()
   TArray<TObjectPtr<UInteractableComponent>> VisibleInteractables;
 
+  /** Detection scratch, reused across updates: candidates from the
+   * registry's baked grid, their locations, and InteractionMath results */
+  TArray<UInteractableComponent *> Candidates;
+  TArray<FVector> CandidateLocations;
+  TArray<int32> CandidateIndices;
+
+  /** Visible interactables found by the current update (scratch) */
+  TSet<UInteractableComponent *> StillVisibleSet;
+
   /** Timer handle for detection updates */
   float TimeSinceLastDetection = 0.0f;
+
+  /** Skip marker visibility bookkeeping (see UInteractionSettings::IsHeadless) */
+  bool bHeadless = false;
+
+  /** Viewer bit from the registry, see GetViewerIndex */
+  int32 ViewerIndex = INDEX_NONE;
+
+  /** TypeFilter compiled to a type id bitmask */
+  FInteractionTypeFilter CompiledTypeFilter;
+
+  /** Last request id sent (client); doubles as the prediction key */
+  uint16 LastRequestId = 0;
+
+  /** Interaction applied locally and waiting for the server's result */
+  struct FPendingPrediction {
+    uint16 RequestId = 0;
+    TWeakObjectPtr<UInteractableComponent> Target;
+    double StartTime = 0.0;
+  };
+
+  /** Unanswered predictions, oldest first (client, bounded by settings) */
+  TArray<FPendingPrediction, TInlineAllocator<8>> PendingPredictions;
+
+  /** Prediction counters (client) */
+  FInteractionPredictionStats PredictionStats;
+
+  /** Marker prefetch counters */
+  FInteractionPrefetchStats PrefetchStats;
+
+  /** Results waiting for the next net update (server) */
+  TArray<FInteractionResult> PendingResults;
+
+  /** Time of the last result flush (server) */
+  double LastResultFlushTime = 0.0;
+
+  /** Token bucket for request rate limiting (server) */
+  float RequestTokens = 0.0f;
+  double LastTokenRefillTime = 0.0;
 };
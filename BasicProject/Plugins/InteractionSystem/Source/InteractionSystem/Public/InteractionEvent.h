@@ -0,0 +1,174 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "InteractionTypes.h"
+#include "UObject/ObjectKey.h"
+#include <type_traits>
+
+class UInteractableComponent;
+
+/** Compact interaction type identifier (0 = unknown / overflow) */
+using FInteractionTypeId = uint16;
+
+/**
+ * Process-wide registry mapping interaction type tags to compact ids
+ * Ids are stable for the lifetime of the process and never reused, so a
+ * filter compiled against the first N ids stays valid as types are added.
+ *
+ * 상호작용 타입 태그를 컴팩트 Id로 매핑하는 프로세스 전역 레지스트리
+ * Id는 프로세스 수명 동안 유지되며 재사용되지 않음 - 컴파일된 필터는
+ * 타입이 추가되어도 기존 Id에 대해 유효
+ */
+class INTERACTIONSYSTEM_API FInteractionTypeRegistry {
+public:
+  /** Maximum number of distinct interaction types */
+  static constexpr int32 MaxTypes = 256;
+
+  /** Get the id for a type, registering it on first use (0 if full/invalid) */
+  static FInteractionTypeId GetId(const FGameplayTag &InteractionType);
+
+  /** Get the type for an id (empty tag if unknown) */
+  static FGameplayTag GetTag(FInteractionTypeId TypeId);
+
+  /** Number of ids handed out so far (including the reserved id 0) */
+  static int32 Num();
+};
+
+/**
+ * Gameplay tag query compiled into a bitmask over interaction type ids
+ * Matching an event is a single bit test. Types registered after the last
+ * compile are evaluated against the query once, on first sight.
+ *
+ * 상호작용 타입 Id 비트마스크로 컴파일된 게임플레이 태그 쿼리
+ * 이벤트 매칭은 비트 검사 한 번 - 새로 등록된 타입만 처음 볼 때 평가
+ */
+struct INTERACTIONSYSTEM_API FInteractionTypeFilter {
+  FInteractionTypeFilter() = default;
+
+  /** Compile a query (an empty query matches every type) */
+  explicit FInteractionTypeFilter(const FGameplayTagQuery &InQuery);
+
+  /** Replace the query and recompile */
+  void SetQuery(const FGameplayTagQuery &InQuery);
+
+  /** Check a type id against the compiled mask */
+  bool Matches(FInteractionTypeId TypeId) const {
+    if (bMatchAll) {
+      return true;
+    }
+    if (TypeId >= FInteractionTypeRegistry::MaxTypes) {
+      return false;
+    }
+    if (TypeId >= NumCompiled) {
+      CompileNewTypes();
+    }
+    return (Mask[TypeId >> 6] & (1ull << (TypeId & 63))) != 0;
+  }
+
+  /** True if the filter accepts every type */
+  bool MatchesAll() const { return bMatchAll; }
+
+  /** Compile every type registered so far; Matches is then read-only for
+   * those ids and safe to call from worker threads */
+  void CompileRegisteredTypes() const {
+    if (!bMatchAll && NumCompiled < FInteractionTypeRegistry::Num()) {
+      CompileNewTypes();
+    }
+  }
+
+private:
+  /** Evaluate the query for ids registered since the last compile */
+  void CompileNewTypes() const;
+
+  FGameplayTagQuery Query;
+  mutable uint64 Mask[FInteractionTypeRegistry::MaxTypes / 64] = {};
+  mutable int32 NumCompiled = 1;
+  bool bMatchAll = true;
+};
+
+/**
+ * Compact interaction event
+ * Trivially copyable and cache-line sized: holds object keys instead of
+ * pointers, so it can be queued across frames and threads. Objects and the
+ * display text are resolved on demand (resolve on the game thread only).
+ *
+ * 컴팩트 상호작용 이벤트
+ * 포인터 대신 오브젝트 키를 보관하는 POD - 프레임/스레드 간 저장 가능
+ * 오브젝트와 표시 텍스트는 필요할 때 게임 스레드에서 해석
+ */
+struct INTERACTIONSYSTEM_API FInteractionEvent {
+  /** The actor that initiated the interaction (usually the player) */
+  FObjectKey Instigator;
+
+  /** The interactable component being interacted with */
+  FObjectKey TargetComponent;
+
+  /** Packed MassEntity handle for entity interactables (0 for components) */
+  uint64 TargetEntity = 0;
+
+  /** FPlatformTime::Seconds() when the event was created */
+  double Timestamp = 0.0;
+
+  /** Frame counter (truncated) when the event was created */
+  uint32 FrameNumber = 0;
+
+  /** Interaction type id (see FInteractionTypeRegistry) */
+  FInteractionTypeId TypeId = 0;
+
+  /** Event flags (EFlags) */
+  uint8 Flags = 0;
+
+  enum EFlags : uint8 {
+    /** Event has been handled (stops further propagation) */
+    Flag_Handled = 1 << 0,
+  };
+
+  /** Create an event for a component, stamped with the current time/frame */
+  static FInteractionEvent Make(const UInteractableComponent *Component,
+                                const AActor *InteractionInstigator);
+
+  /** Create an event for an entity interactable (no component) */
+  static FInteractionEvent MakeForEntity(uint64 EntityId,
+                                         FInteractionTypeId TypeId,
+                                         const AActor *InteractionInstigator);
+
+  /** Create an event from its Blueprint-facing view */
+  static FInteractionEvent FromEventData(const FInteractionEventData &EventData);
+
+  /** Build the Blueprint-facing view (resolves objects and display text) */
+  FInteractionEventData ToEventData() const;
+
+  bool IsEntityTarget() const { return TargetEntity != 0; }
+
+  bool IsHandled() const { return (Flags & Flag_Handled) != 0; }
+  void SetHandled(bool bHandled) {
+    Flags = bHandled ? (Flags | Flag_Handled) : (Flags & ~Flag_Handled);
+  }
+
+  /** Interaction type */
+  FGameplayTag GetInteractionType() const {
+    return FInteractionTypeRegistry::GetTag(TypeId);
+  }
+
+  //~ On-demand resolution (game thread)
+
+  AActor *ResolveInstigator() const;
+  UInteractableComponent *ResolveTargetComponent() const;
+  AActor *ResolveTargetActor() const;
+  FText ResolveDisplayText() const;
+};
+
+static_assert(std::is_trivially_copyable_v<FInteractionEvent>,
+              "FInteractionEvent must stay trivially copyable");
+static_assert(sizeof(FInteractionEvent) <= PLATFORM_CACHE_LINE_SIZE,
+              "FInteractionEvent must fit in a cache line");
+
+/**
+ * Native delegate for C++ listeners that work on the compact event
+ * 컴팩트 이벤트를 받는 C++ 리스너용 네이티브 델리게이트
+ */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnInteractionEventNative,
+                                    FInteractionEvent &);
@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "InteractionInitQueueSubsystem.generated.h"
+
+class UInteractableComponent;
+
+/**
+ * Per-world queue of marker setups (widget component, widget construction),
+ * run under UInteractionSettings::MarkerInitBudgetMs per frame and nearest to
+ * local players first. Widget classes are loaded asynchronously when a setup
+ * is queued, and the setup only joins the budgeted queue once its class is
+ * resident, so no slice blocks on a load. A level with thousands of
+ * interactables then spreads its marker work over frames instead of one
+ * BeginPlay hitch; queued interactables are detectable meanwhile, just
+ * without a marker.
+ *
+ * 월드별 마커 초기화 큐 - 프레임당 시간 예산 내에서 로컬 플레이어와 가까운
+ * 순서로 위젯 생성을 처리하여 레벨 로드 시 BeginPlay 히치를 분산
+ * 위젯 클래스는 큐에 추가될 때 비동기 로드되며, 로드 후에만 처리됨
+ * 대기 중인 대상도 탐지/상호작용은 가능하며 마커만 없음
+ */
+UCLASS()
+class INTERACTIONSYSTEM_API UInteractionInitQueueSubsystem
+    : public UTickableWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  //~ Begin USubsystem Interface
+  virtual void Deinitialize() override;
+  //~ End USubsystem Interface
+
+  //~ Begin FTickableGameObject Interface
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+  //~ End FTickableGameObject Interface
+
+  /** Queue an interactable's marker setup (see UInteractableComponent::CreateMarker) */
+  void Enqueue(UInteractableComponent *Interactable);
+
+  /** Marker setups still waiting, including those waiting for their class */
+  int32 GetNumPending() const { return Pending.Num() + NumWaitingForClass; }
+
+protected:
+  //~ Begin UWorldSubsystem Interface
+  virtual bool DoesSupportWorldType(
+      const EWorldType::Type WorldType) const override;
+  //~ End UWorldSubsystem Interface
+
+private:
+  /** Sort Pending farthest first, so the nearest is popped from the back */
+  void SortByViewerDistance();
+
+  /** Move the setups waiting for a widget class into Pending */
+  void HandleWidgetClassLoaded(FSoftObjectPath ClassPath);
+
+  /** Waiting interactables; components that went away are skipped */
+  TArray<TWeakObjectPtr<UInteractableComponent>> Pending;
+
+  /** Widget class load; the handle keeps the class resident for this world */
+  struct FWidgetClassLoad {
+    TSharedPtr<FStreamableHandle> Handle;
+
+    /** Setups queued before the class arrived */
+    TArray<TWeakObjectPtr<UInteractableComponent>> Waiting;
+  };
+
+  /** Loads by widget class path (a handful per world) */
+  TMap<FSoftObjectPath, FWidgetClassLoad> WidgetClassLoads;
+
+  /** Setups in WidgetClassLoads still waiting */
+  int32 NumWaitingForClass = 0;
+
+  /** Enqueued since the last sort */
+  bool bNeedsSort = false;
+
+  /** Players move while a large queue drains; re-sort now and then */
+  double LastSortTime = 0.0;
+};
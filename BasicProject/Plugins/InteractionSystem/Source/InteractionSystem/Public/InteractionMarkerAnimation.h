@@ -0,0 +1,36 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Marker fade/scale animation state
+ * Elastic spring on scale, linear fade on opacity. Plain data so it can live
+ * in a component or a MassEntity fragment and be stepped on any thread.
+ *
+ * 마커 페이드/스케일 애니메이션 상태
+ * 스케일은 탄성 스프링, 불투명도는 선형 페이드 - 컴포넌트와 Mass 프래그먼트에서 공용
+ */
+struct INTERACTIONSYSTEM_API FInteractionMarkerAnimation {
+  float Opacity = 0.0f;
+  float TargetOpacity = 0.0f;
+  float Scale = 0.0f;
+  float TargetScale = 0.0f;
+  float ScaleVelocity = 0.0f;
+
+  /** Start fading in (shown) or out */
+  void SetShown(bool bShown) {
+    TargetOpacity = bShown ? 1.0f : 0.0f;
+    TargetScale = bShown ? 1.0f : 0.0f;
+  }
+
+  /** Faded out, or fading out */
+  bool IsHiding() const { return TargetOpacity == 0.0f && TargetScale == 0.0f; }
+
+  /**
+   * Advance the animation
+   * @return true once both values have settled on their targets
+   */
+  bool Step(float DeltaTime, float FadeDuration, float Elasticity);
+};
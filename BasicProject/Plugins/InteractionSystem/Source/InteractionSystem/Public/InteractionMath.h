@@ -0,0 +1,100 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Engine-independent detection and animation kernels
+ * Only depends on Core math, so it is tested and microbenchmarked without
+ * the engine (the InteractionMathTests low-level test target) and timed on
+ * plain arrays in the editor (-run=InteractionBenchmark -MathOnly). The detector and the Mass detection
+ * processor cull and pick their target through CullByDistance and FindNearest;
+ * the marker and text panel animations step through StepSpringFade.
+ *
+ * 엔진 독립 탐지/애니메이션 커널 (Core 수학만 사용)
+ */
+namespace InteractionMath {
+/** Spring and fade constants derived from the interaction settings */
+struct FSpringParams {
+  float Stiffness = 300.0f;
+  float Damping = 31.0f;
+  float FadeSpeed = 1.0f / 0.3f;
+
+  static FSpringParams Make(float FadeDuration, float Elasticity) {
+    FSpringParams Params;
+    Params.Damping = 15.0f + (10.0f - Elasticity) * 2.0f;
+    Params.FadeSpeed = FadeDuration > 0.0f ? 1.0f / FadeDuration : 100.0f;
+    return Params;
+  }
+};
+
+/**
+ * Advance an elastic scale spring and a linear opacity fade by DeltaTime
+ * Values snap to their targets once settled.
+ * @return true when both values have settled
+ */
+FORCEINLINE bool StepSpringFade(float &Scale, float &ScaleVelocity,
+                                float TargetScale, float &Opacity,
+                                float TargetOpacity,
+                                const FSpringParams &Params, float DeltaTime) {
+  const float Acceleration = (TargetScale - Scale) * Params.Stiffness -
+                             ScaleVelocity * Params.Damping;
+  ScaleVelocity += Acceleration * DeltaTime;
+  Scale = FMath::Max(0.0f, Scale + ScaleVelocity * DeltaTime);
+
+  const float FadeStep = Params.FadeSpeed * DeltaTime;
+  if (Opacity < TargetOpacity) {
+    Opacity = FMath::Min(Opacity + FadeStep, TargetOpacity);
+  } else if (Opacity > TargetOpacity) {
+    Opacity = FMath::Max(Opacity - FadeStep, TargetOpacity);
+  }
+
+  const bool bSettled = FMath::IsNearlyEqual(Scale, TargetScale, 0.01f) &&
+                        FMath::Abs(ScaleVelocity) < 0.1f &&
+                        FMath::IsNearlyEqual(Opacity, TargetOpacity, 0.01f);
+  if (bSettled) {
+    Scale = TargetScale;
+    Opacity = TargetOpacity;
+    ScaleVelocity = 0.0f;
+  }
+  return bSettled;
+}
+
+/**
+ * Indices of the locations strictly within RadiusSq of Origin
+ * @return number of indices written to OutIndices (sized like Locations)
+ */
+FORCEINLINE int32 CullByDistance(TConstArrayView<FVector> Locations,
+                                 const FVector &Origin, double RadiusSq,
+                                 int32 *OutIndices) {
+  int32 NumInside = 0;
+  for (int32 i = 0; i < Locations.Num(); ++i) {
+    // Branch-free append: always write, advance only when inside
+    OutIndices[NumInside] = i;
+    NumInside += FVector::DistSquared(Origin, Locations[i]) < RadiusSq ? 1 : 0;
+  }
+  return NumInside;
+}
+
+/**
+ * Nearest of the given locations strictly within MaxDistanceSq
+ * The first of equidistant locations wins.
+ * @return index into Locations, or INDEX_NONE
+ */
+FORCEINLINE int32 FindNearest(TConstArrayView<FVector> Locations,
+                              TConstArrayView<int32> Indices,
+                              const FVector &Origin, double MaxDistanceSq,
+                              double &OutDistanceSq) {
+  int32 Nearest = INDEX_NONE;
+  OutDistanceSq = MaxDistanceSq;
+  for (const int32 Index : Indices) {
+    const double DistanceSq = FVector::DistSquared(Origin, Locations[Index]);
+    if (DistanceSq < OutDistanceSq) {
+      OutDistanceSq = DistanceSq;
+      Nearest = Index;
+    }
+  }
+  return Nearest;
+}
+} // namespace InteractionMath
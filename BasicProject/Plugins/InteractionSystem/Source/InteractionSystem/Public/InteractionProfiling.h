@@ -0,0 +1,139 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+/**
+ * CSV profiler category for interaction timings (Detection, Routing, ...)
+ * Recorded with `csvprofile start` / `-csvCaptureFrames=N` and by the load
+ * test game mode; rows land in Saved/Profiling/CSV.
+ *
+ * 상호작용 타이밍용 CSV 프로파일러 카테고리
+ * `csvprofile start` 또는 부하 테스트 게임 모드로 기록
+ */
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(INTERACTIONSYSTEM_API, Interaction);
+
+/**
+ * Unreal Insights trace channel for interaction CPU scopes
+ * Off by default; enable with `-trace=default,Interaction` or
+ * `Trace.Enable Interaction`. A disabled channel costs one branch per scope.
+ *
+ * 상호작용 CPU 스코프용 Insights 트레이스 채널 (기본 꺼짐)
+ */
+UE_TRACE_CHANNEL_EXTERN(InteractionChannel, INTERACTIONSYSTEM_API);
+
+/**
+ * `stat Interaction` group: scope timings and per-frame counters
+ * `stat Interaction` 그룹: 스코프 타이밍과 프레임별 카운터
+ */
+DECLARE_STATS_GROUP(TEXT("Interaction"), STATGROUP_Interaction, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Detection"), STAT_InteractionDetection,
+                          STATGROUP_Interaction, INTERACTIONSYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Visibility Diff"),
+                          STAT_InteractionVisibilityDiff,
+                          STATGROUP_Interaction, INTERACTIONSYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Marker Animation"),
+                          STAT_InteractionMarkerAnimation,
+                          STATGROUP_Interaction, INTERACTIONSYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Marker Init"), STAT_InteractionMarkerInit,
+                          STATGROUP_Interaction, INTERACTIONSYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Routing"), STAT_InteractionRouting,
+                          STATGROUP_Interaction, INTERACTIONSYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Handlers"), STAT_InteractionHandlers,
+                          STATGROUP_Interaction, INTERACTIONSYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Validation"), STAT_InteractionValidation,
+                          STATGROUP_Interaction, INTERACTIONSYSTEM_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Candidates Scanned"),
+                                  STAT_InteractionCandidatesScanned,
+                                  STATGROUP_Interaction, INTERACTIONSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Visible Markers"),
+                                  STAT_InteractionVisibleMarkers,
+                                  STATGROUP_Interaction, INTERACTIONSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Animating Markers"),
+                                  STAT_InteractionAnimatingMarkers,
+                                  STATGROUP_Interaction, INTERACTIONSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Events Routed"),
+                                  STAT_InteractionEventsRouted,
+                                  STATGROUP_Interaction, INTERACTIONSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Markers Initialized"),
+                                  STAT_InteractionMarkersInitialized,
+                                  STATGROUP_Interaction, INTERACTIONSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Markers Prefetched"),
+                                  STAT_InteractionMarkersPrefetched,
+                                  STATGROUP_Interaction, INTERACTIONSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Prefetch Hits"),
+                                  STAT_InteractionPrefetchHits,
+                                  STATGROUP_Interaction, INTERACTIONSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Prefetch Misses"),
+                                  STAT_InteractionPrefetchMisses,
+                                  STATGROUP_Interaction, INTERACTIONSYSTEM_API);
+
+/**
+ * Low Level Memory Tracker tags (`-llm`, `stat LLMFULL`, memreport)
+ * Interaction is the plugin total; Markers covers the widget component and
+ * UMG tree, Detection the registry and detector state, Routing the event
+ * subsystems and their listeners.
+ *
+ * LLM 메모리 태그: 마커, 탐지, 이벤트 라우팅 하위 태그
+ */
+LLM_DECLARE_TAG_API(Interaction, INTERACTIONSYSTEM_API);
+LLM_DECLARE_TAG_API(Interaction_Markers, INTERACTIONSYSTEM_API);
+LLM_DECLARE_TAG_API(Interaction_Detection, INTERACTIONSYSTEM_API);
+LLM_DECLARE_TAG_API(Interaction_Routing, INTERACTIONSYSTEM_API);
+
+/**
+ * Memory held by interactables, as reported by Interaction.DumpMemory
+ * Object sizes follow `obj list` (properties and containers plus exclusive
+ * resource size). Slate widgets have no UObject and are only counted; their
+ * bytes show up under the LLM UI tag.
+ *
+ * 상호작용 대상의 메모리 사용량 (Interaction.DumpMemory)
+ */
+struct FInteractableMemoryFootprint {
+  int64 ComponentBytes = 0;
+  int64 MarkerComponentBytes = 0;
+  int64 WidgetBytes = 0;
+  int32 NumWidgets = 0;
+  int32 NumSlateWidgets = 0;
+
+  int64 GetTotalBytes() const {
+    return ComponentBytes + MarkerComponentBytes + WidgetBytes;
+  }
+
+  FInteractableMemoryFootprint &
+  operator+=(const FInteractableMemoryFootprint &Other) {
+    ComponentBytes += Other.ComponentBytes;
+    MarkerComponentBytes += Other.MarkerComponentBytes;
+    WidgetBytes += Other.WidgetBytes;
+    NumWidgets += Other.NumWidgets;
+    NumSlateWidgets += Other.NumSlateWidgets;
+    return *this;
+  }
+};
+
+/**
+ * Times a scope in `stat Interaction` and, when the channel is enabled, as a
+ * named CPU event in Insights
+ */
+#define INTERACTION_SCOPE_CYCLE_COUNTER(Stat)                                  \
+  SCOPE_CYCLE_COUNTER(Stat);                                                   \
+  TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, InteractionChannel)
+
+/**
+ * Insights scope named after a handler; the name is only built while the
+ * channel is enabled
+ */
+#define INTERACTION_HANDLER_TRACE_SCOPE(NameExpression)                        \
+  const bool bInteractionHandlerTraced =                                       \
+      UE_TRACE_CHANNELEXPR_IS_ENABLED(InteractionChannel);                     \
+  FCpuProfilerTrace::FDynamicEventScope InteractionHandlerScope(               \
+      bInteractionHandlerTraced ? *(NameExpression) : TEXT(""),                \
+      InteractionChannel, bInteractionHandlerTraced, __FILE__, __LINE__)
@@ -0,0 +1,227 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InteractionTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "InteractionRegistrySubsystem.generated.h"
+
+class AInteractableIndexActor;
+class UInteractableComponent;
+class UInteractionDetectorComponent;
+struct FInteractableIndexEntry;
+
+/** A loaded level's baked index and the interactables registered from it */
+USTRUCT()
+struct FInteractionBakedLevel {
+  GENERATED_BODY()
+
+  /** Null once the level is removed (the entry is reused) */
+  UPROPERTY()
+  TObjectPtr<const AInteractableIndexActor> Index;
+
+  /** Index actor transform when the level was added */
+  FTransform ToWorld;
+
+  /** Largest definition radius among the entries (0 = detector radii only) */
+  float MaxDefinitionRadius = 0.0f;
+
+  /** Registered component per baked entry (null until it registers) */
+  UPROPERTY()
+  TArray<TObjectPtr<UInteractableComponent>> Resolved;
+};
+
+/**
+ * Per-world registry of interactable components
+ * Hands out generation-checked handles on the server (replicated to clients)
+ * so requests resolve with an O(1) slot lookup, and keeps a dense array that
+ * detectors iterate instead of scanning every actor in the world.
+ *
+ * 월드별 상호작용 컴포넌트 레지스트리
+ * 서버에서 세대 검사 핸들을 발급(클라이언트로 복제) - 요청은 O(1) 슬롯 조회로
+ * 해석되고, 탐지기는 월드 전체 액터 대신 밀집 배열을 순회
+ */
+UCLASS()
+class INTERACTIONSYSTEM_API UInteractionRegistrySubsystem
+    : public UWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  //~ Begin USubsystem Interface
+  virtual void Deinitialize() override;
+  //~ End USubsystem Interface
+
+  /** Register an interactable and allocate a handle (authority) */
+  FInteractableHandle Register(UInteractableComponent *Interactable);
+
+  /**
+   * Register an interactable a client spawned itself (no server handle will
+   * arrive). Its handle comes from the local range (see
+   * FInteractableHandle::LocalIndexBit), which server handles never reuse.
+   */
+  FInteractableHandle RegisterLocal(UInteractableComponent *Interactable);
+
+  /**
+   * Register an interactable under a handle issued by the server (clients)
+   * @param PreviousHandle Handle the component was registered under before,
+   * if any; that entry is replaced so the component is listed once
+   */
+  void RegisterWithHandle(UInteractableComponent *Interactable,
+                          FInteractableHandle Handle,
+                          FInteractableHandle PreviousHandle =
+                              FInteractableHandle());
+
+  /** Remove an interactable; its slot generation is bumped */
+  void Unregister(UInteractableComponent *Interactable);
+
+  /** Resolve a handle (null if stale or unknown) */
+  UInteractableComponent *Resolve(FInteractableHandle Handle) const;
+
+  /** All registered interactables, in no particular order */
+  const TArray<TObjectPtr<UInteractableComponent>> &GetInteractables() const {
+    return Interactables;
+  }
+
+  /**
+   * Registered interactables a detector at Origin has to test: those of baked
+   * levels from the grid cells around Origin, plus every interactable outside
+   * a baked index (spawned, movable, or from levels without one)
+   * @param DetectorRadius Detector radius; baked definitions may extend it
+   * @param ExtraDistance Added to the query radius (e.g. prefetch path)
+   */
+  void GatherCandidates(const FVector &Origin, float DetectorRadius,
+                        float ExtraDistance,
+                        TArray<UInteractableComponent *> &OutCandidates) const;
+
+  /** Track a detector so batch passes (e.g. MassEntity) can see every viewer */
+  void RegisterDetector(UInteractionDetectorComponent *Detector);
+  void UnregisterDetector(UInteractionDetectorComponent *Detector);
+
+  /** Number of bits in an interactable's viewer masks */
+  static constexpr int32 MaxViewers = 32;
+
+  /**
+   * Give a marker-driving detector its bit in the interactables' viewer masks
+   * @return Viewer index, or INDEX_NONE when all MaxViewers bits are taken
+   */
+  int32 AcquireViewerIndex(UInteractionDetectorComponent *Detector);
+  void ReleaseViewerIndex(int32 ViewerIndex);
+
+  /** Detector holding a viewer bit (null if free) */
+  UInteractionDetectorComponent *GetViewer(int32 ViewerIndex) const {
+    return ViewerSlots.IsValidIndex(ViewerIndex) ? ViewerSlots[ViewerIndex]
+                                                 : nullptr;
+  }
+
+  /** Add a loaded level's baked index (see AInteractableIndexActor) at its
+   * current transform and size the registry for the actors about to register */
+  void AddBakedIndex(const AInteractableIndexActor *Index);
+  void RemoveBakedIndex(const AInteractableIndexActor *Index);
+
+  /**
+   * Baked static interactables within Radius of Origin, across loaded levels
+   * Answers from the first frame, before the indexed actors begin play
+   */
+  void QueryBakedInteractables(
+      const FVector &Origin, float Radius,
+      TFunctionRef<void(const FInteractableIndexEntry &Entry,
+                        const FVector &WorldLocation)>
+          Visit) const;
+
+  /** Log interactable memory per owner class (Interaction.DumpMemory) */
+  void DumpMemory() const;
+
+  /** All detectors that have begun play in this world */
+  const TArray<TObjectPtr<UInteractionDetectorComponent>> &GetDetectors() const {
+    return Detectors;
+  }
+
+private:
+  struct FSlot {
+    /** Index into Interactables (INDEX_NONE when free) */
+    int32 DenseIndex = INDEX_NONE;
+    uint32 Generation = 0;
+
+    /** Baked level and entry found at registration, or the position in
+     * Unindexed when BakedLevel is INDEX_NONE */
+    int32 BakedLevel = INDEX_NONE;
+    int32 BakedEntry = INDEX_NONE;
+  };
+
+  /** Slot addressed by a handle index (server range or local range) */
+  FSlot &GetSlot(uint32 SlotIndex) {
+    return SlotIndex & FInteractableHandle::LocalIndexBit
+               ? LocalSlots[SlotIndex & ~FInteractableHandle::LocalIndexBit]
+               : Slots[SlotIndex];
+  }
+  const FSlot &GetSlot(uint32 SlotIndex) const {
+    return const_cast<UInteractionRegistrySubsystem *>(this)->GetSlot(
+        SlotIndex);
+  }
+
+  /** Check if a handle index addresses an allocated slot */
+  bool IsValidSlot(uint32 SlotIndex) const {
+    return SlotIndex & FInteractableHandle::LocalIndexBit
+               ? LocalSlots.IsValidIndex(
+                     SlotIndex & ~FInteractableHandle::LocalIndexBit)
+               : SlotIndex != 0 && Slots.IsValidIndex(SlotIndex);
+  }
+
+  /** Allocate a slot for a newly registered interactable */
+  FInteractableHandle AddSlot(UInteractableComponent *Interactable,
+                              bool bLocal);
+
+  /** Find the slot of a registered interactable */
+  uint32 FindSlotIndex(const UInteractableComponent *Interactable) const;
+
+  /** Remove the dense entry referenced by a slot */
+  void ReleaseSlot(uint32 SlotIndex);
+
+  /** Add a newly registered interactable to its level's baked index, or to
+   * the unindexed list */
+  void LinkBaked(uint32 SlotIndex, UInteractableComponent *Interactable);
+
+  /** Undo LinkBaked before the slot is released */
+  void UnlinkBaked(uint32 SlotIndex);
+
+  /** Append a registered interactable to Unindexed */
+  void AddUnindexed(uint32 SlotIndex, UInteractableComponent *Interactable);
+
+  /** Sparse slots addressed by handle index (slot 0 reserved) */
+  TArray<FSlot> Slots;
+
+  /** Free slot indices (authority only) */
+  TArray<uint32> FreeSlots;
+
+  /** Slots of client-local interactables, addressed by handle index without
+   * LocalIndexBit, and their free indices (with the bit) */
+  TArray<FSlot> LocalSlots;
+  TArray<uint32> FreeLocalSlots;
+
+  /** Dense array iterated by detectors */
+  UPROPERTY(Transient)
+  TArray<TObjectPtr<UInteractableComponent>> Interactables;
+
+  /** Slot index per dense entry */
+  TArray<uint32> DenseToSlot;
+
+  /** Registered detectors */
+  UPROPERTY(Transient)
+  TArray<TObjectPtr<UInteractionDetectorComponent>> Detectors;
+
+  /** Registered interactables found in no baked index (scanned in full) */
+  UPROPERTY(Transient)
+  TArray<TObjectPtr<UInteractableComponent>> Unindexed;
+
+  /** Slot index per Unindexed entry */
+  TArray<uint32> UnindexedToSlot;
+
+  /** Baked indices of loaded levels, addressed by FSlot::BakedLevel */
+  UPROPERTY(Transient)
+  TArray<FInteractionBakedLevel> BakedLevels;
+
+  /** Detector per viewer bit (null = free) */
+  UPROPERTY(Transient)
+  TArray<TObjectPtr<UInteractionDetectorComponent>> ViewerSlots;
+};
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "InteractionEvent.h"
 #include "InteractionTypes.h"
 #include "UObject/Interface.h"
 #include "InteractionRouter.generated.h"
@@ -26,29 +27,35 @@ class INTERACTIONSYSTEM_API IInteractionRouter {
 public:
   /**
    * Called when an interaction event should be routed to external systems
-   * @param EventData Interaction event data (can be modified by handlers)
+   * @param Event Compact interaction event (handlers may mark it handled)
    */
-  virtual void RouteInteraction(FInteractionEventData &EventData) = 0;
+  virtual void RouteInteraction(FInteractionEvent &Event) = 0;
 };
 
 /**
- * Static registry for the interaction router
- * MainProject sets the router on startup
+ * Static registry for interaction routers, one per world
+ * MainProject sets the router for each world on startup. Keeping them per
+ * world lets a dedicated server and several PIE clients share one process.
  *
- * 상호작용 라우터를 위한 정적 레지스트리
- * 메인 프로젝트가 시작 시 라우터를 설정함
+ * 월드별 상호작용 라우터를 위한 정적 레지스트리
+ * 메인 프로젝트가 월드마다 시작 시 라우터를 설정함 - 데디케이티드 서버와
+ * 여러 PIE 클라이언트가 한 프로세스에서 동작 가능
  */
 class INTERACTIONSYSTEM_API FInteractionRouterRegistry {
 public:
-  /** Set the global router (called by MainProject on init) */
-  static void SetRouter(TScriptInterface<IInteractionRouter> InRouter);
+  /** Set the router of a world (null clears it) */
+  static void SetRouter(const UWorld *World,
+                        TScriptInterface<IInteractionRouter> InRouter);
 
-  /** Get the global router */
-  static TScriptInterface<IInteractionRouter> GetRouter();
+  /** Get the router of a world */
+  static TScriptInterface<IInteractionRouter> GetRouter(const UWorld *World);
 
-  /** Route an event through the registered router */
+  /** Route an event through the router of the target's world */
+  static void Route(FInteractionEvent &Event);
+
+  /** Route a Blueprint-facing event (converted to the compact event) */
   static void Route(FInteractionEventData &EventData);
 
 private:
-  static TScriptInterface<IInteractionRouter> GlobalRouter;
+  static TMap<FObjectKey, TScriptInterface<IInteractionRouter>> Routers;
 };
@@ -7,6 +7,7 @@
 #include "InteractionSettings.generated.h"
 
 class UUserWidget;
+class UWorld;
 
 /**
  * Interaction System Settings
@@ -27,6 +28,17 @@ public:
   UFUNCTION(BlueprintPure, Category = "Interaction")
   static UInteractionSettings *Get();
 
+  /**
+   * Whether marker UI work should be skipped in this world
+   * True in server builds, dedicated servers (including PIE), -nullrhi and
+   * when Interaction.ForceHeadless is set. Detection still runs.
+   *
+   * 이 월드에서 마커 UI 작업을 생략할지 여부
+   * 서버 빌드, 데디케이티드 서버(PIE 포함), -nullrhi,
+   * Interaction.ForceHeadless 설정 시 true - 탐지는 계속 동작
+   */
+  static bool IsHeadless(const UWorld *World);
+
   //~ Begin UDeveloperSettings Interface
   virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
   virtual FName GetSectionName() const override {
@@ -51,6 +63,12 @@ public:
             meta = (DisplayName = "Default Widget Class"))
   TSoftClassPtr<UUserWidget> DefaultWidgetClass;
 
+  /** Game thread time per frame for creating queued marker widgets, nearest
+   * to local players first (0 = create each marker in its BeginPlay) */
+  UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "UI",
+            meta = (DisplayName = "Marker Init Budget (ms)", ClampMin = "0.0"))
+  float MarkerInitBudgetMs = 1.0f;
+
   /** Default visibility radius in cm (marker appears) */
   UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Detection",
             meta = (DisplayName = "Default Visibility Radius",
@@ -73,4 +91,48 @@ public:
             meta = (DisplayName = "Default Animation Elasticity",
                     ClampMin = "0.0", ClampMax = "10.0"))
   float DefaultAnimationElasticity = 2.0f;
+
+  /** Extra range the server allows on top of InteractionRadius (cm), to absorb
+   * movement between the client's press and the server's check */
+  UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Networking",
+            meta = (DisplayName = "Server Range Tolerance", ClampMin = "0.0"))
+  float ServerRangeTolerance = 50.0f;
+
+  /** Sustained interaction requests per second allowed per player */
+  UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Networking",
+            meta = (DisplayName = "Max Requests Per Second", ClampMin = "0.1"))
+  float MaxRequestsPerSecond = 5.0f;
+
+  /** Requests a player may burst before the rate limit applies */
+  UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Networking",
+            meta = (DisplayName = "Request Burst", ClampMin = "1"))
+  int32 RequestBurst = 3;
+
+  /** Requests older than this (server time, seconds) are rejected */
+  UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Networking",
+            meta = (DisplayName = "Max Request Age", ClampMin = "0.0"))
+  float MaxRequestAgeSeconds = 1.0f;
+
+  /** How far ahead of server time a request timestamp may be (seconds), for
+   * drift in the client's synced clock; later ones are rejected */
+  UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Networking",
+            meta = (DisplayName = "Max Request Clock Skew", ClampMin = "0.0"))
+  float MaxRequestClockSkewSeconds = 0.25f;
+
+  /** Apply interactions locally on clients before the server answers */
+  UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Networking",
+            meta = (DisplayName = "Enable Client Prediction"))
+  bool bEnableClientPrediction = true;
+
+  /** Unanswered predictions per detector; the oldest is rolled back beyond it */
+  UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Networking",
+            meta = (DisplayName = "Max Pending Predictions", ClampMin = "1",
+                    EditCondition = "bEnableClientPrediction"))
+  int32 MaxPendingPredictions = 8;
+
+  /** Predictions without a server answer after this long are rolled back */
+  UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Networking",
+            meta = (DisplayName = "Prediction Timeout", ClampMin = "0.1",
+                    EditCondition = "bEnableClientPrediction"))
+  float PredictionTimeoutSeconds = 2.0f;
 };
@@ -5,10 +5,19 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 
+INTERACTIONSYSTEM_API DECLARE_LOG_CATEGORY_EXTERN(LogInteractionSystem, Log,
+                                                  All);
+
 class FInteractionSystemModule : public IModuleInterface
 {
 public:
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+#if WITH_EDITOR
+private:
+	/** Creates missing level indices when levels are saved or cooked */
+	FDelegateHandle PreSaveHandle;
+#endif
 };
@@ -0,0 +1,22 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NativeGameplayTags.h"
+
+/**
+ * Native gameplay tags owned by the interaction system
+ * Project-specific interaction types (Interaction.Door, Interaction.Loot.*)
+ * live in Config/DefaultGameplayTags.ini.
+ *
+ * 상호작용 시스템이 소유하는 네이티브 게임플레이 태그
+ * 프로젝트별 타입은 Config/DefaultGameplayTags.ini에 정의
+ */
+namespace InteractionTags {
+/** Root of every interaction type */
+INTERACTIONSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Interaction);
+
+/** Type used by interactables that do not set one */
+INTERACTIONSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Interaction_Default);
+} // namespace InteractionTags
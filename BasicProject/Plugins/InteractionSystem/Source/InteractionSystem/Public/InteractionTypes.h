@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
 #include "InteractionTypes.generated.h"
 
 class UInteractableComponent;
@@ -28,9 +29,10 @@ struct INTERACTIONSYSTEM_API FInteractionEventData {
   UPROPERTY(BlueprintReadWrite, Category = "Interaction")
   UInteractableComponent *TargetComponent = nullptr;
 
-  /** Identifier for the type of interaction (e.g., "Door", "Item", "NPC") */
-  UPROPERTY(BlueprintReadWrite, Category = "Interaction")
-  FName InteractionType;
+  /** Type of interaction (e.g., Interaction.Door, Interaction.Loot.Chest) */
+  UPROPERTY(BlueprintReadWrite, Category = "Interaction",
+            meta = (Categories = "Interaction"))
+  FGameplayTag InteractionType;
 
   /** Text to display in the UI widget */
   UPROPERTY(BlueprintReadWrite, Category = "Interaction")
@@ -41,6 +43,177 @@ struct INTERACTIONSYSTEM_API FInteractionEventData {
   bool bHandled = false;
 };
 
+/**
+ * Compact network handle for a registered interactable
+ * Packs a registry slot index and a generation counter into 32 bits and is
+ * sent as a packed int, so stale handles to recycled slots are rejected.
+ *
+ * 등록된 상호작용 대상의 컴팩트 네트워크 핸들
+ * 레지스트리 슬롯 인덱스와 세대 카운터를 32비트로 패킹 - 재사용된 슬롯의
+ * 오래된 핸들은 거부됨
+ */
+USTRUCT(BlueprintType)
+struct INTERACTIONSYSTEM_API FInteractableHandle {
+  GENERATED_BODY()
+
+  /** Bits used for the slot index (the rest hold the generation) */
+  static constexpr uint32 IndexBits = 20;
+  static constexpr uint32 IndexMask = (1u << IndexBits) - 1;
+  static constexpr uint32 MaxGeneration = (1u << (32 - IndexBits)) - 1;
+
+  /** Index bit of handles a client issues for interactables it spawned
+   * itself; server indices stay below it, so the two never collide */
+  static constexpr uint32 LocalIndexBit = 1u << (IndexBits - 1);
+
+  FInteractableHandle() = default;
+  FInteractableHandle(uint32 InIndex, uint32 InGeneration)
+      : Value((InGeneration << IndexBits) | (InIndex & IndexMask)) {}
+
+  /** Slot index (0 = invalid handle) */
+  uint32 GetIndex() const { return Value & IndexMask; }
+
+  /** Generation of the slot when the handle was issued */
+  uint32 GetGeneration() const { return Value >> IndexBits; }
+
+  bool IsValid() const { return GetIndex() != 0; }
+
+  /** Issued by a client for a local interactable (never replicated) */
+  bool IsLocal() const { return (GetIndex() & LocalIndexBit) != 0; }
+
+  bool operator==(const FInteractableHandle &Other) const {
+    return Value == Other.Value;
+  }
+  bool operator!=(const FInteractableHandle &Other) const {
+    return Value != Other.Value;
+  }
+
+  /** Packed serialization (1-4 bytes instead of a full object reference) */
+  bool NetSerialize(FArchive &Ar, class UPackageMap *Map, bool &bOutSuccess) {
+    Ar.SerializeIntPacked(Value);
+    bOutSuccess = true;
+    return true;
+  }
+
+  friend uint32 GetTypeHash(const FInteractableHandle &Handle) {
+    return Handle.Value;
+  }
+
+private:
+  UPROPERTY()
+  uint32 Value = 0;
+};
+
+template <>
+struct TStructOpsTypeTraits<FInteractableHandle>
+    : public TStructOpsTypeTraitsBase2<FInteractableHandle> {
+  enum { WithNetSerializer = true, WithIdenticalViaEquality = true };
+};
+
+/**
+ * Outcome of a server-validated interaction request
+ * 서버 검증 상호작용 요청 결과
+ */
+UENUM(BlueprintType)
+enum class EInteractionResultCode : uint8 {
+  Accepted,
+  /** Handle did not resolve (destroyed or recycled interactable) */
+  InvalidTarget,
+  /** Target has bCanInteract disabled */
+  Disabled,
+  /** Instigator is outside the interaction radius on the server */
+  OutOfRange,
+  /** Instigator exceeded its request rate */
+  RateLimited,
+  /** Request timestamp older than the allowed age, or ahead of the server */
+  Expired,
+};
+
+/**
+ * Server response to one interaction request (sent to clients in batches)
+ * 상호작용 요청 하나에 대한 서버 응답 (클라이언트로 일괄 전송)
+ */
+USTRUCT(BlueprintType)
+struct INTERACTIONSYSTEM_API FInteractionResult {
+  GENERATED_BODY()
+
+  /** Client-assigned request id this result answers */
+  UPROPERTY()
+  uint16 RequestId = 0;
+
+  /** Interactable the request targeted */
+  UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+  FInteractableHandle Target;
+
+  /** Validation outcome */
+  UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+  EInteractionResultCode Code = EInteractionResultCode::Accepted;
+};
+
+/**
+ * Client-side prediction counters of a detector
+ * Latency saved is the time between a predicted press and its confirmation,
+ * i.e. the round trip the player did not have to wait for
+ *
+ * 탐지기의 클라이언트 예측 통계
+ * 절약된 지연 = 예측 입력부터 서버 확인까지의 시간 (플레이어가 기다리지 않은 왕복 시간)
+ */
+USTRUCT(BlueprintType)
+struct INTERACTIONSYSTEM_API FInteractionPredictionStats {
+  GENERATED_BODY()
+
+  UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+  int32 NumPredicted = 0;
+
+  UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+  int32 NumConfirmed = 0;
+
+  /** Rejected by the server and rolled back */
+  UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+  int32 NumRolledBack = 0;
+
+  /** No answer within PredictionTimeoutSeconds (or evicted) and rolled back */
+  UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+  int32 NumTimedOut = 0;
+
+  UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+  float TotalLatencySavedSeconds = 0.0f;
+
+  UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+  float MaxLatencySavedSeconds = 0.0f;
+
+  float GetAverageLatencySavedSeconds() const {
+    return NumConfirmed > 0 ? TotalLatencySavedSeconds / NumConfirmed : 0.0f;
+  }
+};
+
+/**
+ * Marker prefetch counters of a detector
+ * A hit is a marker first shown after the detector prepared it ahead of time;
+ * a miss was prepared on the frame it became visible
+ *
+ * 탐지기의 마커 프리페치 통계
+ * 적중 = 미리 준비된 뒤 처음 표시된 마커, 실패 = 보이는 프레임에 준비된 마커
+ */
+USTRUCT(BlueprintType)
+struct INTERACTIONSYSTEM_API FInteractionPrefetchStats {
+  GENERATED_BODY()
+
+  /** Markers prepared ahead of time */
+  UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+  int32 NumPrefetched = 0;
+
+  UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+  int32 NumHits = 0;
+
+  UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+  int32 NumMisses = 0;
+
+  float GetHitRate() const {
+    const int32 NumShown = NumHits + NumMisses;
+    return NumShown > 0 ? static_cast<float>(NumHits) / NumShown : 0.0f;
+  }
+};
+
 /**
  * Delegate for local interaction handling (within the component or its owner)
  * 로컬 상호작용 처리용 델리게이트
@@ -63,3 +236,26 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractionEvent,
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractionTargetChanged,
                                             UInteractableComponent *,
                                             NewTarget);
+
+/**
+ * Delegate for server results of interaction requests (owning client)
+ * 상호작용 요청에 대한 서버 결과 델리게이트 (소유 클라이언트)
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInteractionResult,
+                                             const FInteractionResult &,
+                                             Result, UInteractableComponent *,
+                                             Target);
+
+/**
+ * Delegate for an interaction predicted by the local client
+ * 로컬 클라이언트가 예측한 상호작용 델리게이트
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractPredicted, AActor *,
+                                            InteractionInstigator);
+
+/**
+ * Delegate for a predicted interaction that was rejected or timed out
+ * 거부되었거나 시간 초과된 예측 상호작용 델리게이트
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractionPredictionRolledBack,
+                                            EInteractionResultCode, Reason);
@@ -4,6 +4,7 @@
 
 #include "Blueprint/UserWidget.h"
 #include "CoreMinimal.h"
+#include "InteractionMarkerAnimation.h"
 #include "InteractionWidget.generated.h"
 
 class UInteractableComponent;
@@ -25,6 +26,7 @@ class INTERACTIONSYSTEM_API UInteractionWidget : public UUserWidget {
 
 public:
   virtual void NativeConstruct() override;
+  virtual void NativeDestruct() override;
   virtual void NativeTick(const FGeometry &MyGeometry,
                           float InDeltaTime) override;
 
@@ -56,8 +58,14 @@ public:
   UFUNCTION(BlueprintPure, Category = "Interaction")
   bool IsCurrentTarget() const;
 
+  /** Build the Slate widget and fill in the visuals before the marker is
+   * first shown (marker prefetch) */
+  void PrepareForDisplay();
+
 protected:
-  /** Called every tick to update widget visuals */
+  /** Called every tick to update widget visuals; the display text is only
+   * re-applied after the owner's display text serial moved or the culture
+   * changed */
   UFUNCTION(BlueprintNativeEvent, Category = "Interaction")
   void UpdateWidgetVisuals();
   virtual void UpdateWidgetVisuals_Implementation();
@@ -92,11 +100,18 @@ protected:
   TObjectPtr<UTextBlock> TextBlock_DisplayText;
 
 private:
-  /** Text panel animation state */
-  float CurrentTextPanelOpacity = 0.0f;
-  float TargetTextPanelOpacity = 0.0f;
-  float CurrentTextPanelScale = 0.0f;
-  float TargetTextPanelScale = 0.0f;
-  float TextPanelScaleVelocity = 0.0f;
+  /** Culture changed: re-apply the text on the next update */
+  void HandleDisplayTextChanged();
+
+  /** Display text needs to be re-applied to TextBlock_DisplayText */
+  bool bDisplayTextDirty = true;
+
+  /** Owner display text serial the text block was last filled from */
+  uint16 AppliedDisplayTextSerial = 0;
+
+  FDelegateHandle CultureChangedHandle;
+
+  /** Text panel animation state (same spring/fade as the marker) */
+  FInteractionMarkerAnimation TextPanelAnimation;
   bool bIsTextPanelAnimating = false;
 };
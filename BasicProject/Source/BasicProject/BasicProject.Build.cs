@@ -14,10 +14,11 @@ public class BasicProject : ModuleRules
 			"Engine", 
 			"InputCore", 
 			"EnhancedInput",
+			"GameplayTags",
 			"InteractionSystem"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] {  });
+		PrivateDependencyModuleNames.AddRange(new string[] { "Json" });
 
 		// Uncomment if you are using Slate UI
 		// PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
@@ -3,4 +3,6 @@
 #include "BasicProject.h"
 #include "Modules/ModuleManager.h"
 
+DEFINE_LOG_CATEGORY(LogBasicProject);
+
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, BasicProject, "BasicProject" );
@@ -0,0 +1,592 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "InteractionBenchmarkCommandlet.h"
+#include "../Subsystems/InteractionEventSubsystem.h"
+#include "BasicProject.h"
+#include "Components/SceneComponent.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "InteractableComponent.h"
+#include "InteractableDefinition.h"
+#include "InteractionDetectorComponent.h"
+#include "InteractionMarkerAnimation.h"
+#include "InteractionMath.h"
+#include "InteractionRouter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectIterator.h"
+
+namespace InteractionBenchmarkCommandlet {
+/** Routed events per count measurement */
+constexpr int32 NumRoutedEvents = 100000;
+
+/** Marker animation frames per count measurement */
+constexpr int32 NumAnimationFrames = 60;
+
+/** Spawn an actor with a scene root at Location */
+AActor *SpawnRootedActor(UWorld *World, const FVector &Location) {
+  FActorSpawnParameters SpawnParams;
+  SpawnParams.SpawnCollisionHandlingOverride =
+      ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+  AActor *Actor = World->SpawnActor<AActor>(AActor::StaticClass(),
+                                            FTransform(Location), SpawnParams);
+  if (Actor) {
+    USceneComponent *Root = NewObject<USceneComponent>(Actor, TEXT("Root"));
+    Actor->SetRootComponent(Root);
+    Root->RegisterComponent();
+    Root->SetWorldLocation(Location);
+  }
+  return Actor;
+}
+
+/** Object size as reported by `obj list`, like the registry's memory dump */
+int64 GetObjectBytes(UObject *Object) {
+  if (!Object) {
+    return 0;
+  }
+  FArchiveCountMem CountMem(Object);
+  return static_cast<int64>(CountMem.GetMax()) +
+         static_cast<int64>(
+             Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive));
+}
+
+FVector RandomLocation(FRandomStream &Random, float HalfSize) {
+  return FVector(Random.FRandRange(-HalfSize, HalfSize),
+                 Random.FRandRange(-HalfSize, HalfSize), 0.0f);
+}
+
+/** Baseline metric name and whether larger values are better */
+struct FMetric {
+  const TCHAR *Name;
+  bool bHigherIsBetter;
+};
+} // namespace InteractionBenchmarkCommandlet
+
+UInteractionBenchmarkCommandlet::UInteractionBenchmarkCommandlet() {
+  IsClient = false;
+  IsEditor = false;
+  IsServer = false;
+  LogToConsole = true;
+}
+
+int32 UInteractionBenchmarkCommandlet::Main(const FString &Params) {
+  FString CountsParam = TEXT("1000,10000,100000");
+  FParse::Value(*Params, TEXT("Counts="), CountsParam);
+  FParse::Value(*Params, TEXT("Detectors="), NumDetectors);
+  FParse::Value(*Params, TEXT("Frames="), NumFrames);
+  FParse::Value(*Params, TEXT("Seed="), Seed);
+  FParse::Value(*Params, TEXT("Tolerance="), Tolerance);
+  NumDetectors = FMath::Max(1, NumDetectors);
+  NumFrames = FMath::Max(1, NumFrames);
+
+  if (FParse::Param(*Params, TEXT("MathOnly"))) {
+    return RunMathBenchmarks(Params);
+  }
+
+  FString BaselinePath = FPaths::ProjectDir() /
+                         TEXT("Build/Benchmarks/InteractionBaseline.json");
+  FParse::Value(*Params, TEXT("Baseline="), BaselinePath);
+
+  TArray<FString> CountStrings;
+  CountsParam.ParseIntoArray(CountStrings, TEXT(","));
+
+  TArray<FResult> Results;
+  int32 Mismatches = 0;
+  for (const FString &CountString : CountStrings) {
+    const int32 Count = FCString::Atoi(*CountString);
+    if (Count <= 0) {
+      continue;
+    }
+
+    const FResult &Result = Results.Add_GetRef(RunCount(Count));
+    Mismatches += Result.Mismatches;
+    UE_LOG(LogBasicProject, Display,
+           TEXT("Interaction benchmark %d: detection %.3f ms, animation "
+                "%.1f ns/marker, %.0f bytes/interactable, %.0f events/s, %d "
+                "mismatches"),
+           Result.Count, Result.DetectionMs, Result.AnimationNsPerMarker,
+           Result.BytesPerInteractable, Result.EventsPerSecond,
+           Result.Mismatches);
+  }
+
+  const FString OutputDir =
+      FPaths::ProjectSavedDir() / TEXT("Profiling/InteractionBenchmark");
+  WriteResults(Results, OutputDir / TEXT("InteractionBenchmark.json"));
+
+  if (FParse::Param(*Params, TEXT("WriteBaseline"))) {
+    WriteResults(Results, BaselinePath);
+    UE_LOG(LogBasicProject, Display, TEXT("Baseline written: %s"),
+           *BaselinePath);
+    return Mismatches > 0 ? 1 : 0;
+  }
+
+  const int32 Regressions = CompareBaseline(Results, BaselinePath);
+  if (Mismatches > 0) {
+    UE_LOG(LogBasicProject, Error,
+           TEXT("Detection differs from the brute-force reference in %d "
+                "updates"),
+           Mismatches);
+  }
+  return Mismatches > 0 || Regressions > 0 ? 1 : 0;
+}
+
+int32 UInteractionBenchmarkCommandlet::RunMathBenchmarks(const FString &Params) {
+  using namespace InteractionBenchmarkCommandlet;
+
+  FString BatchSizesParam = TEXT("64,1024,16384,262144");
+  FParse::Value(*Params, TEXT("BatchSizes="), BatchSizesParam);
+  TArray<FString> BatchSizeStrings;
+  BatchSizesParam.ParseIntoArray(BatchSizeStrings, TEXT(","));
+
+  const InteractionMath::FSpringParams SpringParams =
+      InteractionMath::FSpringParams::Make(0.3f, 2.0f);
+  FString Csv = TEXT("BatchSize,CullNs,NearestNs,SpringNs,Visible\n");
+  int32 Mismatches = 0;
+
+  for (const FString &BatchSizeString : BatchSizeStrings) {
+    const int32 BatchSize = FCString::Atoi(*BatchSizeString);
+    if (BatchSize <= 0) {
+      continue;
+    }
+
+    // Same density as the world benchmark; about 30 locations per 3 m circle
+    FRandomStream Random(Seed);
+    const float HalfSize = 50.0f * FMath::Sqrt(static_cast<float>(BatchSize));
+    TArray<FVector> Locations;
+    Locations.SetNumUninitialized(BatchSize);
+    for (FVector &Location : Locations) {
+      Location = RandomLocation(Random, HalfSize);
+    }
+    TArray<int32> Indices;
+    Indices.SetNumUninitialized(BatchSize);
+
+    // Enough repetitions for roughly 16M elements per kernel
+    const int32 Repetitions = FMath::Max(1, (16 << 20) / BatchSize);
+    const double VisibilityRadiusSq = FMath::Square(300.0);
+    const double InteractionRadiusSq = FMath::Square(150.0);
+
+    int32 NumVisible = 0;
+    double StartTime = FPlatformTime::Seconds();
+    for (int32 r = 0; r < Repetitions; ++r) {
+      const FVector Origin = Locations[r % BatchSize];
+      NumVisible += InteractionMath::CullByDistance(Locations, Origin,
+                                                    VisibilityRadiusSq,
+                                                    Indices.GetData());
+    }
+    const double CullSeconds = FPlatformTime::Seconds() - StartTime;
+
+    // Nearest selection over a full index list (worst case)
+    for (int32 i = 0; i < BatchSize; ++i) {
+      Indices[i] = i;
+    }
+    int32 Checksum = 0;
+    StartTime = FPlatformTime::Seconds();
+    for (int32 r = 0; r < Repetitions; ++r) {
+      double DistanceSq = 0.0;
+      Checksum += InteractionMath::FindNearest(
+          Locations, Indices, Locations[r % BatchSize] + FVector(1.0),
+          InteractionRadiusSq, DistanceSq);
+    }
+    const double NearestSeconds = FPlatformTime::Seconds() - StartTime;
+
+    TArray<FInteractionMarkerAnimation> Springs;
+    Springs.SetNum(BatchSize);
+    for (int32 i = 0; i < BatchSize; ++i) {
+      Springs[i].SetShown((i & 1) == 0);
+    }
+    StartTime = FPlatformTime::Seconds();
+    for (int32 r = 0; r < Repetitions; ++r) {
+      for (FInteractionMarkerAnimation &Spring : Springs) {
+        InteractionMath::StepSpringFade(Spring.Scale, Spring.ScaleVelocity,
+                                        Spring.TargetScale, Spring.Opacity,
+                                        Spring.TargetOpacity, SpringParams,
+                                        1.0f / 60.0f);
+      }
+    }
+    const double SpringSeconds = FPlatformTime::Seconds() - StartTime;
+
+    // The kernels must agree with plain scalar loops: the same culled
+    // indices in order, and the same nearest pick for every timed origin
+    const FVector Origin = Locations[0];
+    TArray<int32> ExpectedIndices;
+    for (int32 i = 0; i < BatchSize; ++i) {
+      if (FVector::DistSquared(Origin, Locations[i]) < VisibilityRadiusSq) {
+        ExpectedIndices.Add(i);
+      }
+    }
+    const int32 NumCulled = InteractionMath::CullByDistance(
+        Locations, Origin, VisibilityRadiusSq, Indices.GetData());
+    if (TArray<int32>(Indices.GetData(), NumCulled) != ExpectedIndices) {
+      UE_LOG(LogBasicProject, Error,
+             TEXT("Interaction math %d: culling differs from the scalar "
+                  "reference"),
+             BatchSize);
+      Mismatches++;
+    }
+
+    int32 ExpectedChecksum = 0;
+    for (int32 r = 0; r < Repetitions; ++r) {
+      const FVector NearestOrigin = Locations[r % BatchSize] + FVector(1.0);
+      int32 Nearest = INDEX_NONE;
+      double NearestDistanceSq = InteractionRadiusSq;
+      for (int32 i = 0; i < BatchSize; ++i) {
+        const double DistanceSq =
+            FVector::DistSquared(NearestOrigin, Locations[i]);
+        if (DistanceSq < NearestDistanceSq) {
+          NearestDistanceSq = DistanceSq;
+          Nearest = i;
+        }
+      }
+      ExpectedChecksum += Nearest;
+    }
+    if (Checksum != ExpectedChecksum) {
+      UE_LOG(LogBasicProject, Error,
+             TEXT("Interaction math %d: nearest checksum %d, reference %d"),
+             BatchSize, Checksum, ExpectedChecksum);
+      Mismatches++;
+    }
+
+    const double Elements = static_cast<double>(BatchSize) * Repetitions;
+    const double CullNs = CullSeconds * 1.0e9 / Elements;
+    const double NearestNs = NearestSeconds * 1.0e9 / Elements;
+    const double SpringNs = SpringSeconds * 1.0e9 / Elements;
+    const double AverageVisible = static_cast<double>(NumVisible) / Repetitions;
+    UE_LOG(LogBasicProject, Display,
+           TEXT("Interaction math %d: cull %.2f ns, nearest %.2f ns, spring "
+                "%.2f ns per element (%.1f visible, checksum %d)"),
+           BatchSize, CullNs, NearestNs, SpringNs, AverageVisible, Checksum);
+    Csv += FString::Printf(TEXT("%d,%.3f,%.3f,%.3f,%.1f\n"), BatchSize, CullNs,
+                           NearestNs, SpringNs, AverageVisible);
+  }
+
+  FFileHelper::SaveStringToFile(
+      Csv, *(FPaths::ProjectSavedDir() /
+             TEXT("Profiling/InteractionBenchmark/InteractionMath.csv")));
+  return Mismatches > 0 ? 1 : 0;
+}
+
+UInteractionBenchmarkCommandlet::FResult
+UInteractionBenchmarkCommandlet::RunCount(int32 Count) {
+  using namespace InteractionBenchmarkCommandlet;
+
+  FResult Result;
+  Result.Count = Count;
+
+  // Constant density (about one interactable per square meter), so the
+  // visible set stays similar and only the scanned count grows
+  WorldHalfSize = 50.0f * FMath::Sqrt(static_cast<float>(Count));
+  FRandomStream Random(Seed);
+
+  UWorld *World = UWorld::CreateWorld(EWorldType::Game, false,
+                                      TEXT("InteractionBenchmark"));
+  FWorldContext &WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+  WorldContext.SetCurrentWorld(World);
+  World->InitializeActorsForPlay(FURL());
+  World->GetWorldSettings()->NotifyBeginPlay();
+
+  TArray<UInteractableComponent *> Interactables;
+  Interactables.Reserve(Count);
+  for (int32 i = 0; i < Count; ++i) {
+    AActor *Actor = SpawnRootedActor(World, RandomLocation(Random, WorldHalfSize));
+    UInteractableComponent *Interactable =
+        NewObject<UInteractableComponent>(Actor);
+    Interactable->RegisterComponent();
+    Interactables.Add(Interactable);
+  }
+
+  // Memory per interactable: actor, scene root and the interactable's own
+  // footprint, counted per object rather than from the noisy process total
+  int64 InteractableBytes = 0;
+  for (UInteractableComponent *Interactable : Interactables) {
+    FInteractableMemoryFootprint Footprint;
+    Interactable->AccumulateMemoryFootprint(Footprint);
+    AActor *Actor = Interactable->GetOwner();
+    InteractableBytes += Footprint.GetTotalBytes() + GetObjectBytes(Actor) +
+                         GetObjectBytes(Actor->GetRootComponent());
+  }
+  Result.BytesPerInteractable = static_cast<double>(InteractableBytes) / Count;
+
+  TArray<UInteractionDetectorComponent *> Detectors;
+  for (int32 i = 0; i < NumDetectors; ++i) {
+    AActor *Actor = SpawnRootedActor(World, RandomLocation(Random, WorldHalfSize));
+    UInteractionDetectorComponent *Detector =
+        NewObject<UInteractionDetectorComponent>(Actor);
+    // No local player and possibly no RHI: keep the visible set regardless
+    Detector->bAlwaysTrackVisibleSet = true;
+    Detector->RegisterComponent();
+    Detectors.Add(Detector);
+  }
+
+  // Detection: detectors wander so the visible set changes every frame
+  double DetectionSeconds = 0.0;
+  for (int32 Frame = 0; Frame < NumFrames; ++Frame) {
+    for (UInteractionDetectorComponent *Detector : Detectors) {
+      AActor *Owner = Detector->GetOwner();
+      Owner->SetActorLocation(Owner->GetActorLocation() +
+                              FVector(Random.FRandRange(-50.0f, 50.0f),
+                                      Random.FRandRange(-50.0f, 50.0f), 0.0f));
+
+      const double StartTime = FPlatformTime::Seconds();
+      Detector->ForceUpdateDetection();
+      DetectionSeconds += FPlatformTime::Seconds() - StartTime;
+
+      if (!VerifyDetector(Detector)) {
+        Result.Mismatches++;
+      }
+    }
+  }
+  Result.DetectionMs = DetectionSeconds * 1000.0 / (NumFrames * NumDetectors);
+
+  // Marker animation: one state per interactable, half fading in
+  TArray<FInteractionMarkerAnimation> Markers;
+  Markers.SetNum(Count);
+  for (int32 i = 0; i < Count; ++i) {
+    Markers[i].SetShown((i & 1) == 0);
+  }
+  const double AnimationStart = FPlatformTime::Seconds();
+  for (int32 Frame = 0; Frame < NumAnimationFrames; ++Frame) {
+    for (FInteractionMarkerAnimation &Marker : Markers) {
+      Marker.Step(1.0f / 60.0f, 0.3f, 2.0f);
+    }
+  }
+  Result.AnimationNsPerMarker = (FPlatformTime::Seconds() - AnimationStart) *
+                                1.0e9 / (static_cast<double>(Count) *
+                                         NumAnimationFrames);
+
+  // Routing throughput through the world's UInteractionEventSubsystem
+  if (UInteractionEventSubsystem *EventSubsystem =
+          World->GetSubsystem<UInteractionEventSubsystem>()) {
+    int32 NumReceived = 0;
+    const FDelegateHandle Handle = EventSubsystem->Subscribe(
+        FGameplayTagQuery(),
+        FOnInteractionEventNative::FDelegate::CreateLambda(
+            [&NumReceived](FInteractionEvent &Event) {
+              NumReceived++;
+              Event.SetHandled(true);
+            }));
+
+    const AActor *Instigator = Detectors[0]->GetOwner();
+    const double RoutingStart = FPlatformTime::Seconds();
+    for (int32 i = 0; i < NumRoutedEvents; ++i) {
+      FInteractionEvent Event;
+      Event.Instigator = FObjectKey(Instigator);
+      Event.TargetComponent = FObjectKey(Interactables[i % Count]);
+      Event.TypeId = Interactables[i % Count]->GetInteractionTypeId();
+      Event.Timestamp = FPlatformTime::Seconds();
+      Event.FrameNumber = static_cast<uint32>(GFrameCounter);
+      FInteractionRouterRegistry::Route(Event);
+    }
+    const double RoutingSeconds = FPlatformTime::Seconds() - RoutingStart;
+    EventSubsystem->Unsubscribe(Handle);
+
+    Result.EventsPerSecond =
+        RoutingSeconds > 0.0 ? NumReceived / RoutingSeconds : 0.0;
+  }
+
+  World->DestroyWorld(false);
+  GEngine->DestroyWorldContext(World);
+  CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+  return Result;
+}
+
+bool UInteractionBenchmarkCommandlet::VerifyDetector(
+    const UInteractionDetectorComponent *Detector) const {
+  const AActor *Owner = Detector->GetOwner();
+  const FVector OwnerLocation = Owner->GetActorLocation();
+  const FInteractionTypeFilter &Filter = Detector->GetCompiledTypeFilter();
+
+  TSet<const UInteractableComponent *> ExpectedVisible;
+  const UInteractableComponent *ExpectedTarget = nullptr;
+  float ExpectedDistanceSq = TNumericLimits<float>::Max();
+
+  // Brute force: every interactable component in the world, no registry
+  for (TObjectIterator<UInteractableComponent> It; It; ++It) {
+    const UInteractableComponent *Interactable = *It;
+    const AActor *Actor = Interactable->GetOwner();
+    if (Interactable->GetWorld() != Detector->GetWorld() || !Actor ||
+        Actor == Owner || !Interactable->CanInteract() ||
+        Interactable->IsPredictedUse() ||
+        !Filter.Matches(Interactable->GetInteractionTypeId())) {
+      continue;
+    }
+
+    const UInteractableDefinition *Definition = Interactable->GetDefinition();
+    const float VisibilityRadiusSq =
+        FMath::Square(UInteractableDefinition::ResolveVisibilityRadius(
+            Definition, Detector->VisibilityRadius));
+    const float InteractionRadiusSq =
+        FMath::Square(UInteractableDefinition::ResolveInteractionRadius(
+            Definition, Detector->InteractionRadius));
+    const float DistanceSq =
+        FVector::DistSquared(OwnerLocation, Actor->GetActorLocation());
+    if (DistanceSq < VisibilityRadiusSq) {
+      ExpectedVisible.Add(Interactable);
+      if (DistanceSq < InteractionRadiusSq && DistanceSq < ExpectedDistanceSq) {
+        ExpectedDistanceSq = DistanceSq;
+        ExpectedTarget = Interactable;
+      }
+    }
+  }
+
+  // Equidistant candidates may legitimately resolve either way
+  const UInteractableComponent *Target = Detector->GetCurrentTarget();
+  bool bMatches = Target == ExpectedTarget;
+  if (!bMatches && Target && ExpectedTarget) {
+    bMatches = FVector::DistSquared(OwnerLocation,
+                                    Target->GetOwner()->GetActorLocation()) ==
+               ExpectedDistanceSq;
+  }
+
+  // Benchmark detectors track their visible set without a viewer bit
+  const TArray<TObjectPtr<UInteractableComponent>> &Visible =
+      Detector->GetVisibleInteractables();
+  bMatches &= Visible.Num() == ExpectedVisible.Num();
+  for (const UInteractableComponent *Interactable : Visible) {
+    bMatches &= ExpectedVisible.Contains(Interactable);
+  }
+  return bMatches;
+}
+
+void UInteractionBenchmarkCommandlet::WriteResults(
+    const TArray<FResult> &Results, const FString &JsonPath) const {
+  TArray<TSharedPtr<FJsonValue>> JsonResults;
+  FString Csv = TEXT("Count,DetectionMs,AnimationNsPerMarker,"
+                     "BytesPerInteractable,EventsPerSecond,Mismatches\n");
+
+  for (const FResult &Result : Results) {
+    TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+    Object->SetNumberField(TEXT("Count"), Result.Count);
+    Object->SetNumberField(TEXT("DetectionMs"), Result.DetectionMs);
+    Object->SetNumberField(TEXT("AnimationNsPerMarker"),
+                           Result.AnimationNsPerMarker);
+    Object->SetNumberField(TEXT("BytesPerInteractable"),
+                           Result.BytesPerInteractable);
+    Object->SetNumberField(TEXT("EventsPerSecond"), Result.EventsPerSecond);
+    Object->SetNumberField(TEXT("Mismatches"), Result.Mismatches);
+    JsonResults.Add(MakeShared<FJsonValueObject>(Object));
+
+    Csv += FString::Printf(TEXT("%d,%.4f,%.2f,%.0f,%.0f,%d\n"), Result.Count,
+                           Result.DetectionMs, Result.AnimationNsPerMarker,
+                           Result.BytesPerInteractable, Result.EventsPerSecond,
+                           Result.Mismatches);
+  }
+
+  TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+  Root->SetNumberField(TEXT("Detectors"), NumDetectors);
+  Root->SetNumberField(TEXT("Frames"), NumFrames);
+  Root->SetNumberField(TEXT("Seed"), Seed);
+  Root->SetArrayField(TEXT("Results"), JsonResults);
+
+  FString Json;
+  FJsonSerializer::Serialize(Root, TJsonWriterFactory<>::Create(&Json));
+  FFileHelper::SaveStringToFile(Json, *JsonPath);
+  FFileHelper::SaveStringToFile(Csv,
+                                *FPaths::ChangeExtension(JsonPath, TEXT("csv")));
+}
+
+int32 UInteractionBenchmarkCommandlet::CompareBaseline(
+    const TArray<FResult> &Results, const FString &BaselinePath) const {
+  using InteractionBenchmarkCommandlet::FMetric;
+
+  FString Json;
+  TSharedPtr<FJsonObject> Baseline;
+  if (!FFileHelper::LoadFileToString(Json, *BaselinePath) ||
+      !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json),
+                                    Baseline) ||
+      !Baseline) {
+    UE_LOG(LogBasicProject, Error,
+           TEXT("No interaction benchmark baseline at %s (record one with "
+                "-WriteBaseline)"),
+           *BaselinePath);
+    return 1;
+  }
+
+  // Numbers only compare under the configuration they were recorded with
+  int32 Regressions = 0;
+  const int32 RunConfig[] = {NumDetectors, NumFrames, Seed};
+  const TCHAR *ConfigNames[] = {TEXT("Detectors"), TEXT("Frames"),
+                                TEXT("Seed")};
+  for (int32 i = 0; i < UE_ARRAY_COUNT(RunConfig); ++i) {
+    int32 BaselineValue = 0;
+    if (!Baseline->TryGetNumberField(ConfigNames[i], BaselineValue) ||
+        BaselineValue != RunConfig[i]) {
+      Regressions++;
+      UE_LOG(LogBasicProject, Error,
+             TEXT("Interaction benchmark: -%s=%d, baseline recorded with %d"),
+             ConfigNames[i], RunConfig[i], BaselineValue);
+    }
+  }
+
+  // Memory is platform dependent but stable; times are compared relative to
+  // the machine the baseline was recorded on
+  static const FMetric Metrics[] = {
+      {TEXT("DetectionMs"), false},
+      {TEXT("AnimationNsPerMarker"), false},
+      {TEXT("BytesPerInteractable"), false},
+      {TEXT("EventsPerSecond"), true},
+  };
+
+  const TArray<TSharedPtr<FJsonValue>> *BaselineResults = nullptr;
+  Baseline->TryGetArrayField(TEXT("Results"), BaselineResults);
+  for (const FResult &Actual : Results) {
+    const TSharedPtr<FJsonValue> *Value =
+        BaselineResults ? BaselineResults->FindByPredicate(
+                              [&Actual](const TSharedPtr<FJsonValue> &Entry) {
+                                return Entry->AsObject()->GetIntegerField(
+                                           TEXT("Count")) == Actual.Count;
+                              })
+                        : nullptr;
+    if (!Value) {
+      Regressions++;
+      UE_LOG(LogBasicProject, Error,
+             TEXT("Interaction benchmark %d: no baseline for this count "
+                  "(record one with -WriteBaseline)"),
+             Actual.Count);
+      continue;
+    }
+
+    const TSharedPtr<FJsonObject> &Expected = (*Value)->AsObject();
+    const int32 Count = Actual.Count;
+
+    const double ActualValues[] = {Actual.DetectionMs,
+                                   Actual.AnimationNsPerMarker,
+                                   Actual.BytesPerInteractable,
+                                   Actual.EventsPerSecond};
+    for (int32 i = 0; i < UE_ARRAY_COUNT(Metrics); ++i) {
+      double ExpectedValue = 0.0;
+      // Metrics not recorded yet are reported, not counted as regressions
+      if (!Expected->TryGetNumberField(Metrics[i].Name, ExpectedValue)) {
+        UE_LOG(LogBasicProject, Warning,
+               TEXT("Interaction benchmark %d: %s not recorded in the "
+                    "baseline, skipped (record it with -WriteBaseline)"),
+               Count, Metrics[i].Name);
+        continue;
+      }
+      if (ExpectedValue <= 0.0) {
+        continue;
+      }
+
+      const double Ratio = ActualValues[i] / ExpectedValue;
+      const bool bRegressed = Metrics[i].bHigherIsBetter
+                                  ? Ratio < 1.0 - Tolerance
+                                  : Ratio > 1.0 + Tolerance;
+      if (bRegressed) {
+        Regressions++;
+        UE_LOG(LogBasicProject, Error,
+               TEXT("Interaction benchmark %d: %s %.3f vs baseline %.3f "
+                    "(tolerance %.0f%%)"),
+               Count, Metrics[i].Name, ActualValues[i], ExpectedValue,
+               Tolerance * 100.0f);
+      }
+    }
+  }
+  return Regressions;
+}
@@ -0,0 +1,89 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "CoreMinimal.h"
+#include "InteractionBenchmarkCommandlet.generated.h"
+
+class UInteractionDetectorComponent;
+
+/**
+ * Headless performance benchmark for the interaction system
+ * Spawns N interactables in a generated world and measures detection
+ * (UpdateInteractables), marker animation, memory per interactable and
+ * routing throughput through UInteractionEventSubsystem. Every detection
+ * update is checked against a brute-force reference. Results are written as
+ * JSON and CSV and compared against a recorded baseline.
+ *
+ * 상호작용 시스템 헤드리스 성능 벤치마크
+ * 생성된 월드에 N개의 상호작용 대상을 배치하여 탐지, 마커 애니메이션,
+ * 대상당 메모리, 라우팅 처리량을 측정하고 기준값과 비교합니다.
+ *
+ * UnrealEditor-Cmd BasicProject.uproject -run=InteractionBenchmark -nullrhi
+ *   -unattended [-Counts=1000,10000,100000] [-Detectors=8] [-Frames=60]
+ *   [-Seed=1] [-Baseline=<File>] [-Tolerance=0.25] [-WriteBaseline]
+ *
+ * -MathOnly skips the world and only times the InteractionMath kernels
+ * (distance culling, nearest selection, spring stepping) at -BatchSizes=,
+ * checking their results against scalar loops. Their correctness tests live
+ * in the InteractionMathTests target, which runs without the editor.
+ */
+UCLASS()
+class BASICPROJECT_API UInteractionBenchmarkCommandlet : public UCommandlet {
+  GENERATED_BODY()
+
+public:
+  UInteractionBenchmarkCommandlet();
+
+  //~ Begin UCommandlet Interface
+  virtual int32 Main(const FString &Params) override;
+  //~ End UCommandlet Interface
+
+private:
+  /** Measurements for one interactable count */
+  struct FResult {
+    int32 Count = 0;
+    double DetectionMs = 0.0;
+    double AnimationNsPerMarker = 0.0;
+    double BytesPerInteractable = 0.0;
+    double EventsPerSecond = 0.0;
+    int32 Mismatches = 0;
+  };
+
+  /**
+   * Time the engine-free InteractionMath kernels at several batch sizes
+   * @return process exit code
+   */
+  int32 RunMathBenchmarks(const FString &Params);
+
+  /** Run every measurement for one interactable count in a fresh world */
+  FResult RunCount(int32 Count);
+
+  /**
+   * Compare a detector against a brute-force scan of the world
+   * @return false if the target or the visible set differ
+   */
+  bool VerifyDetector(const UInteractionDetectorComponent *Detector) const;
+
+  /** Write Results as JSON and CSV under Saved/Profiling */
+  void WriteResults(const TArray<FResult> &Results,
+                    const FString &JsonPath) const;
+
+  /**
+   * Compare against a baseline JSON file
+   * A missing baseline, count or metric and a different run configuration
+   * fail like a regression, so the gate cannot pass without data.
+   * @return number of failures
+   */
+  int32 CompareBaseline(const TArray<FResult> &Results,
+                        const FString &BaselinePath) const;
+
+  int32 NumDetectors = 8;
+  int32 NumFrames = 60;
+  int32 Seed = 1;
+  float Tolerance = 0.25f;
+
+  /** Interactables are scattered over a square of this half size (cm) */
+  float WorldHalfSize = 0.0f;
+};
@@ -1,33 +1,324 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "GlobalInteractionSubsystem.h"
+#include "BasicProject.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "InteractionProfiling.h"
+#include "Misc/Paths.h"
+
+namespace GlobalInteractionSubsystem {
+/** Stats file path, unique per PIE instance so clients do not collide */
+FString GetStatsFilePath(const UGameInstance *GameInstance) {
+  FString FileName = TEXT("InteractionStats");
+  if (const FWorldContext *WorldContext =
+          GameInstance ? GameInstance->GetWorldContext() : nullptr) {
+    if (WorldContext->PIEInstance != INDEX_NONE) {
+      FileName += FString::Printf(TEXT("_PIE%d"), WorldContext->PIEInstance);
+    }
+  }
+  return FPaths::ProjectSavedDir() / TEXT("Interaction") /
+         (FileName + TEXT(".bin"));
+}
+} // namespace GlobalInteractionSubsystem
 
 void UGlobalInteractionSubsystem::Initialize(
     FSubsystemCollectionBase &Collection) {
+  LLM_SCOPE_BYTAG(Interaction_Routing);
   Super::Initialize(Collection);
   TotalInteractionCount = 0;
   InteractionCountByType.Empty();
+  Telemetry = MakeUnique<FInteractionTelemetry>();
+
+  // Rules load off the game thread; interactions are queued until they land
+  Achievements = MakeUnique<FInteractionAchievementEngine>();
+  QueuedAchievementEvents.Empty();
+  QueuedCountByType.Empty();
+  bAchievementSetLoading = !AchievementSet.IsNull();
+  if (bAchievementSetLoading) {
+    AchievementSetHandle =
+        UAssetManager::GetStreamableManager().RequestAsyncLoad(
+            AchievementSet.ToSoftObjectPath(),
+            FStreamableDelegate::CreateUObject(
+                this, &UGlobalInteractionSubsystem::HandleAchievementSetLoaded));
+  }
+
+  // Load persisted counters off the game thread; interactions tracked before
+  // the load completes are kept and saved as part of the first delta
+  bStatsLoaded = false;
+  SavedTotalInteractionCount = 0;
+  SavedCountByType.Empty();
+  UnsavedUnlocks.Empty();
+  StatsStore = MakeUnique<FInteractionStatsStore>(
+      GlobalInteractionSubsystem::GetStatsFilePath(GetGameInstance()));
+
+  TWeakObjectPtr<UGlobalInteractionSubsystem> WeakThis(this);
+  StatsStore->LoadAsync([WeakThis](FInteractionStatsRecord &&Loaded) {
+    if (UGlobalInteractionSubsystem *This = WeakThis.Get()) {
+      This->HandleStatsLoaded(MoveTemp(Loaded));
+    }
+  });
+
+  if (StatsSaveInterval > 0.0f) {
+    SaveTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(
+            this, &UGlobalInteractionSubsystem::HandleSaveTick),
+        StatsSaveInterval);
+  }
 }
 
 void UGlobalInteractionSubsystem::Deinitialize() {
+  FTSTicker::GetCoreTicker().RemoveTicker(SaveTickerHandle);
+  SaveTickerHandle.Reset();
+
+  if (AchievementSetHandle) {
+    AchievementSetHandle->CancelHandle();
+    AchievementSetHandle.Reset();
+  }
+  bAchievementSetLoading = false;
+  QueuedAchievementEvents.Empty();
+  QueuedCountByType.Empty();
+
+  // Final save; waiting here is acceptable because we are shutting down
+  SaveStatsAsync();
+  StatsStore.Reset();
+  Achievements.Reset();
+
   OnGlobalInteraction.Clear();
+  OnStatsLoaded.Clear();
+  OnAchievementUnlocked.Clear();
   Super::Deinitialize();
 }
 
 void UGlobalInteractionSubsystem::TrackInteraction(
     FInteractionEventData &EventData) {
+  FInteractionEvent Event = FInteractionEvent::FromEventData(EventData);
+  TOptional<FInteractionEventData> EventView(EventData);
+  TrackRoutedInteraction(Event, EventView, FPlatformTime::Cycles64());
+  EventData.bHandled = Event.IsHandled();
+}
+
+void UGlobalInteractionSubsystem::TrackRoutedInteraction(
+    FInteractionEvent &Event, TOptional<FInteractionEventData> &EventView,
+    uint64 RouteStartCycles) {
+  LLM_SCOPE_BYTAG(Interaction_Routing);
+  const FName InteractionType = Event.GetInteractionType().GetTagName();
   TotalInteractionCount++;
 
   // Track by type
-  int32 &Count = InteractionCountByType.FindOrAdd(EventData.InteractionType);
+  int32 &Count = InteractionCountByType.FindOrAdd(InteractionType);
   Count++;
 
   // Broadcast to global listeners (achievements, analytics, etc.)
-  OnGlobalInteraction.Broadcast(EventData);
+  if (OnGlobalInteraction.IsBound()) {
+    if (!EventView.IsSet()) {
+      EventView.Emplace(Event.ToEventData());
+    }
+    EventView->bHandled = Event.IsHandled();
+    OnGlobalInteraction.Broadcast(*EventView);
+    Event.SetHandled(EventView->bHandled);
+  }
+
+  // Only the rules indexed under this type are touched
+  if (bAchievementSetLoading) {
+    FQueuedAchievementEvent &Queued =
+        QueuedAchievementEvents.AddDefaulted_GetRef();
+    Queued.Event = Event;
+    if (const AActor *Target = Event.ResolveTargetActor()) {
+      Queued.TargetLocation = Target->GetActorLocation();
+    }
+    ++QueuedCountByType.FindOrAdd(InteractionType);
+  } else if (Achievements->HasRules()) {
+    TArray<FName, TInlineAllocator<4>> Unlocked;
+    Achievements->ProcessEvent(
+        Event,
+        [&Event](FVector &OutLocation) {
+          const AActor *Target = Event.ResolveTargetActor();
+          if (!Target) {
+            return false;
+          }
+          OutLocation = Target->GetActorLocation();
+          return true;
+        },
+        Unlocked);
+    BroadcastUnlocked(Unlocked);
+  }
+
+  // Latency covers world routing plus global listeners
+  Telemetry->Record(InteractionType, Event.Instigator,
+                    FPlatformTime::Cycles64() - RouteStartCycles);
 }
 
 int32 UGlobalInteractionSubsystem::GetInteractionCountByType(
-    FName InteractionType) const {
-  const int32 *Count = InteractionCountByType.Find(InteractionType);
+    FGameplayTag InteractionType) const {
+  const int32 *Count = InteractionCountByType.Find(InteractionType.GetTagName());
   return Count ? *Count : 0;
 }
+
+int32 UGlobalInteractionSubsystem::GetInteractionCountMatching(
+    const FGameplayTagQuery &TypeQuery) const {
+  int32 Total = 0;
+  for (const TPair<FName, int32> &Pair : InteractionCountByType) {
+    const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(Pair.Key, false);
+    if (Tag.IsValid() && TypeQuery.Matches(FGameplayTagContainer(Tag))) {
+      Total += Pair.Value;
+    }
+  }
+  return Total;
+}
+
+float UGlobalInteractionSubsystem::GetInteractionsPerSecond(
+    FGameplayTag InteractionType, int32 WindowSeconds) const {
+  return Telemetry->GetEventsPerSecond(InteractionType.GetTagName(),
+                                       WindowSeconds);
+}
+
+float UGlobalInteractionSubsystem::GetRoutingLatencyPercentileMs(
+    float Percentile) const {
+  return static_cast<float>(Telemetry->GetLatencyPercentileMs(Percentile));
+}
+
+int64 UGlobalInteractionSubsystem::GetInteractionCountByInstigator(
+    const AActor *Instigator) const {
+  return Telemetry->GetCountByInstigator(Instigator);
+}
+
+void UGlobalInteractionSubsystem::GetTypeTelemetry(
+    TArray<FInteractionTypeTelemetry> &OutTypes, int32 WindowSeconds) const {
+  Telemetry->GetTypeSnapshot(OutTypes, WindowSeconds);
+}
+
+void UGlobalInteractionSubsystem::GetInstigatorTelemetry(
+    TArray<FInstigatorTelemetry> &OutInstigators) const {
+  Telemetry->GetInstigatorSnapshot(OutInstigators);
+}
+
+void UGlobalInteractionSubsystem::AddAchievementRules(
+    const UInteractionAchievementSet *Set) {
+  if (!Set || !Achievements) {
+    return;
+  }
+  const int32 FirstRule = Achievements->AddRules(Set->Rules);
+
+  // New rules start from the counts so far; persisted counts that are still
+  // loading are added by HandleStatsLoaded, queued interactions are replayed
+  // by HandleAchievementSetLoaded
+  TArray<FName, TInlineAllocator<4>> Unlocked;
+  for (const TPair<FName, int32> &Pair : InteractionCountByType) {
+    const int32 *QueuedCount = QueuedCountByType.Find(Pair.Key);
+    Achievements->AddPersistedCount(
+        FGameplayTag::RequestGameplayTag(Pair.Key, false),
+        Pair.Value - (QueuedCount ? *QueuedCount : 0), Unlocked, FirstRule);
+  }
+  BroadcastUnlocked(Unlocked);
+}
+
+void UGlobalInteractionSubsystem::HandleAchievementSetLoaded() {
+  // May run inside RequestAsyncLoad if the set is already resident
+  bAchievementSetLoading = false;
+  AchievementSetHandle.Reset();
+  const UInteractionAchievementSet *Set = AchievementSet.Get();
+  UE_CLOG(!Set, LogBasicProject, Warning,
+          TEXT("Achievement set %s failed to load"),
+          *AchievementSet.ToString());
+  AddAchievementRules(Set);
+
+  // Evaluate the interactions tracked meanwhile, in order
+  TArray<FQueuedAchievementEvent> Queued = MoveTemp(QueuedAchievementEvents);
+  QueuedAchievementEvents.Reset();
+  QueuedCountByType.Reset();
+  if (!Achievements->HasRules()) {
+    return;
+  }
+
+  TArray<FName, TInlineAllocator<4>> Unlocked;
+  for (const FQueuedAchievementEvent &Entry : Queued) {
+    Achievements->ProcessEvent(
+        Entry.Event,
+        [&Entry](FVector &OutLocation) {
+          if (!Entry.TargetLocation.IsSet()) {
+            return false;
+          }
+          OutLocation = Entry.TargetLocation.GetValue();
+          return true;
+        },
+        Unlocked);
+  }
+  BroadcastUnlocked(Unlocked);
+}
+
+bool UGlobalInteractionSubsystem::IsAchievementUnlocked(
+    FName AchievementId) const {
+  return Achievements && Achievements->IsUnlocked(AchievementId);
+}
+
+float UGlobalInteractionSubsystem::GetAchievementProgress(
+    FName AchievementId) const {
+  return Achievements ? Achievements->GetProgress(AchievementId) : 0.0f;
+}
+
+void UGlobalInteractionSubsystem::BroadcastUnlocked(
+    TConstArrayView<FName> Unlocked) {
+  // Saved with the next delta so the unlock is not reported again next launch
+  UnsavedUnlocks.Append(Unlocked.GetData(), Unlocked.Num());
+  for (const FName AchievementId : Unlocked) {
+    OnAchievementUnlocked.Broadcast(AchievementId);
+  }
+}
+
+void UGlobalInteractionSubsystem::SaveStatsAsync() {
+  if (!StatsStore) {
+    return;
+  }
+
+  // Capture only what changed since the last save; the store serialises and
+  // writes on its own pipe, after the initial load has been merged there
+  FInteractionStatsRecord Delta;
+  Delta.TotalCount = TotalInteractionCount - SavedTotalInteractionCount;
+  for (const TPair<FName, int32> &Pair : InteractionCountByType) {
+    const int32 *SavedCount = SavedCountByType.Find(Pair.Key);
+    const int32 Changed = Pair.Value - (SavedCount ? *SavedCount : 0);
+    if (Changed != 0) {
+      Delta.CountByType.Add(Pair.Key, Changed);
+      SavedCountByType.FindOrAdd(Pair.Key) = Pair.Value;
+    }
+  }
+  SavedTotalInteractionCount = TotalInteractionCount;
+  Delta.UnlockedAchievements = MoveTemp(UnsavedUnlocks);
+  UnsavedUnlocks.Reset();
+
+  StatsStore->SaveDeltaAsync(MoveTemp(Delta));
+}
+
+void UGlobalInteractionSubsystem::HandleStatsLoaded(
+    FInteractionStatsRecord &&Loaded) {
+  // Persisted values are already on disk, so they raise both the live
+  // counters and the saved baseline; session counts stay in the next delta
+  TotalInteractionCount += Loaded.TotalCount;
+  SavedTotalInteractionCount += Loaded.TotalCount;
+  for (const TPair<FName, int32> &Pair : Loaded.CountByType) {
+    InteractionCountByType.FindOrAdd(Pair.Key) += Pair.Value;
+    SavedCountByType.FindOrAdd(Pair.Key) += Pair.Value;
+  }
+
+  // Seed the rules before anyone hears about the load: rules a listener
+  // adds from OnStatsLoaded then start from the merged counts, once
+  Achievements->RestoreUnlocked(Loaded.UnlockedAchievements);
+  TArray<FName, TInlineAllocator<4>> Unlocked;
+  for (const TPair<FName, int32> &Pair : Loaded.CountByType) {
+    Achievements->AddPersistedCount(
+        FGameplayTag::RequestGameplayTag(Pair.Key, false), Pair.Value,
+        Unlocked);
+  }
+
+  bStatsLoaded = true;
+  BroadcastUnlocked(Unlocked);
+  OnStatsLoaded.Broadcast();
+}
+
+bool UGlobalInteractionSubsystem::HandleSaveTick(float DeltaTime) {
+  SaveStatsAsync();
+  return true;
+}
@@ -3,10 +3,23 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Engine/StreamableManager.h"
+#include "GameplayTagContainer.h"
+#include "InteractionAchievements.h"
+#include "InteractionEvent.h"
+#include "InteractionStatsStore.h"
+#include "InteractionTelemetry.h"
 #include "InteractionTypes.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "GlobalInteractionSubsystem.generated.h"
 
+/** Delegate fired once persisted statistics have been merged in */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnInteractionStatsLoaded);
+
+/** Delegate fired when an achievement rule is satisfied */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractionAchievementUnlocked,
+                                            FName, AchievementId);
 
 /**
  * Game Instance Subsystem for global interaction tracking
@@ -14,8 +27,14 @@
  *
  * 글로벌 상호작용 추적 서브시스템
  * 레벨 전환에도 유지됨 - 업적, 통계 등에 사용
+ *
+ * Counters are loaded and saved incrementally on a background pipe
+ * 카운터는 백그라운드 파이프에서 비동기 로드 및 증분 저장됨
+ *
+ * Achievement rules are evaluated incrementally as events arrive
+ * 업적 규칙은 이벤트 도착 시 증분 평가됨
  */
-UCLASS()
+UCLASS(Config = Game)
 class BASICPROJECT_API UGlobalInteractionSubsystem
     : public UGameInstanceSubsystem {
   GENERATED_BODY()
@@ -36,6 +55,16 @@ public:
   UFUNCTION(BlueprintCallable, Category = "Interaction")
   void TrackInteraction(UPARAM(ref) FInteractionEventData &EventData);
 
+  /**
+   * Track an interaction event that was routed starting at RouteStartCycles
+   * The elapsed time is recorded as routing latency in the telemetry
+   * @param EventView Blueprint view shared with earlier listeners; built here
+   * only if a global Blueprint listener exists
+   */
+  void TrackRoutedInteraction(FInteractionEvent &Event,
+                              TOptional<FInteractionEventData> &EventView,
+                              uint64 RouteStartCycles);
+
   /** Delegate for global interaction events (achievements, analytics, etc.) */
   UPROPERTY(BlueprintAssignable, Category = "Interaction")
   FOnInteractionEvent OnGlobalInteraction;
@@ -44,14 +73,144 @@ public:
   UFUNCTION(BlueprintPure, Category = "Interaction")
   int32 GetTotalInteractionCount() const { return TotalInteractionCount; }
 
-  /** Get interaction count by type */
+  /** Get interaction count for an exact type */
   UFUNCTION(BlueprintPure, Category = "Interaction")
-  int32 GetInteractionCountByType(FName InteractionType) const;
+  int32 GetInteractionCountByType(FGameplayTag InteractionType) const;
+
+  /** Get the summed count of every type matching a query (e.g. all Loot) */
+  UFUNCTION(BlueprintPure, Category = "Interaction")
+  int32 GetInteractionCountMatching(const FGameplayTagQuery &TypeQuery) const;
+
+  //~ Persistence
+
+  /** True once persisted statistics have been loaded and merged */
+  UFUNCTION(BlueprintPure, Category = "Interaction|Persistence")
+  bool AreStatsLoaded() const { return bStatsLoaded; }
+
+  /** Queue a save of the counters changed since the last save */
+  UFUNCTION(BlueprintCallable, Category = "Interaction|Persistence")
+  void SaveStatsAsync();
+
+  /** Called once persisted statistics have been merged into the counters and
+   * the achievement rules */
+  UPROPERTY(BlueprintAssignable, Category = "Interaction|Persistence")
+  FOnInteractionStatsLoaded OnStatsLoaded;
+
+  /** Seconds between automatic saves (0 = only save on shutdown) */
+  UPROPERTY(Config, EditAnywhere, Category = "Interaction|Persistence",
+            meta = (ClampMin = "0.0"))
+  float StatsSaveInterval = 30.0f;
+
+  //~ Achievements
+
+  /** Rules loaded asynchronously at startup (optional); interactions tracked
+   * before they arrive are evaluated once they do */
+  UPROPERTY(Config, EditAnywhere, Category = "Interaction|Achievements")
+  TSoftObjectPtr<UInteractionAchievementSet> AchievementSet;
+
+  /** Add achievement rules at runtime; ids already known are ignored */
+  UFUNCTION(BlueprintCallable, Category = "Interaction|Achievements")
+  void AddAchievementRules(const UInteractionAchievementSet *Set);
+
+  UFUNCTION(BlueprintPure, Category = "Interaction|Achievements")
+  bool IsAchievementUnlocked(FName AchievementId) const;
+
+  /** Progress towards an achievement, 0..1 */
+  UFUNCTION(BlueprintPure, Category = "Interaction|Achievements")
+  float GetAchievementProgress(FName AchievementId) const;
+
+  /** Called once per achievement when its rule is satisfied (unlocks from
+   * earlier sessions are restored from the stats file without a call) */
+  UPROPERTY(BlueprintAssignable, Category = "Interaction|Achievements")
+  FOnInteractionAchievementUnlocked OnAchievementUnlocked;
+
+  //~ Telemetry (fixed-size, cheap enough to poll every frame)
+
+  /** Get events per second for a type over the last N seconds (empty = all) */
+  UFUNCTION(BlueprintPure, Category = "Interaction|Telemetry")
+  float GetInteractionsPerSecond(FGameplayTag InteractionType,
+                                 int32 WindowSeconds = 10) const;
+
+  /** Get routing latency percentile (0..1) in milliseconds */
+  UFUNCTION(BlueprintPure, Category = "Interaction|Telemetry")
+  float GetRoutingLatencyPercentileMs(float Percentile = 0.95f) const;
+
+  /** Get interaction count for an instigator (0 if not tracked) */
+  UFUNCTION(BlueprintPure, Category = "Interaction|Telemetry")
+  int64 GetInteractionCountByInstigator(const AActor *Instigator) const;
+
+  /** Get per-type telemetry for all tracked types */
+  UFUNCTION(BlueprintCallable, Category = "Interaction|Telemetry")
+  void GetTypeTelemetry(TArray<FInteractionTypeTelemetry> &OutTypes,
+                        int32 WindowSeconds = 10) const;
+
+  /** Get per-instigator telemetry for all tracked instigators */
+  UFUNCTION(BlueprintCallable, Category = "Interaction|Telemetry")
+  void
+  GetInstigatorTelemetry(TArray<FInstigatorTelemetry> &OutInstigators) const;
+
+  /** Direct access to the telemetry aggregator (C++ only) */
+  const FInteractionTelemetry &GetTelemetry() const { return *Telemetry; }
 
 private:
+  /** Merge statistics loaded from disk (game thread) */
+  void HandleStatsLoaded(FInteractionStatsRecord &&Loaded);
+
+  /** Periodic save ticker */
+  bool HandleSaveTick(float DeltaTime);
+
+  /** Add the startup rules and evaluate the interactions queued meanwhile */
+  void HandleAchievementSetLoaded();
+
+  /** Broadcast achievements unlocked by the last engine call */
+  void BroadcastUnlocked(TConstArrayView<FName> Unlocked);
+
   /** Total interactions since game start */
   int32 TotalInteractionCount = 0;
 
   /** Interaction count by type */
   TMap<FName, int32> InteractionCountByType;
+
+  /** Fixed-size telemetry aggregator (rates, latency, instigators) */
+  TUniquePtr<FInteractionTelemetry> Telemetry;
+
+  /** Incremental achievement rule evaluation */
+  TUniquePtr<FInteractionAchievementEngine> Achievements;
+
+  /** Load request of AchievementSet, kept to cancel it on shutdown */
+  TSharedPtr<FStreamableHandle> AchievementSetHandle;
+
+  /** True until AchievementSet loaded; interactions are queued meanwhile */
+  bool bAchievementSetLoading = false;
+
+  /** Interaction tracked while AchievementSet was loading */
+  struct FQueuedAchievementEvent {
+    FInteractionEvent Event;
+
+    /** Target location when tracked, for zone rules */
+    TOptional<FVector> TargetLocation;
+  };
+
+  /** Interactions waiting for AchievementSet, oldest first */
+  TArray<FQueuedAchievementEvent> QueuedAchievementEvents;
+
+  /** Queued interactions by type; rules are seeded from the counts without
+   * them, since they are replayed through the rules */
+  TMap<FName, int32> QueuedCountByType;
+
+  /** Background loader/writer for the counters */
+  TUniquePtr<FInteractionStatsStore> StatsStore;
+
+  /** Counter values as of the last queued save (for delta computation) */
+  int32 SavedTotalInteractionCount = 0;
+  TMap<FName, int32> SavedCountByType;
+
+  /** Achievements unlocked since the last queued save */
+  TArray<FName> UnsavedUnlocks;
+
+  /** True once the persisted stats have been merged into the counters */
+  bool bStatsLoaded = false;
+
+  /** Handle for the periodic save ticker */
+  FTSTicker::FDelegateHandle SaveTickerHandle;
 };
@@ -0,0 +1,211 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "InteractionAchievements.h"
+#include "BasicProject.h"
+
+int32 FInteractionAchievementEngine::AddRules(
+    TConstArrayView<FInteractionAchievementRule> NewRules) {
+  const int32 FirstRule = Rules.Num();
+  for (const FInteractionAchievementRule &Rule : NewRules) {
+    if (Rule.AchievementId.IsNone() ||
+        RuleIndexById.Contains(Rule.AchievementId)) {
+      continue;
+    }
+
+    FCompiledRule &Compiled = Rules.AddDefaulted_GetRef();
+    Compiled.Rule = Rule;
+    Compiled.Rule.TargetCount = FMath::Clamp(Rule.TargetCount, 1, 256);
+    Compiled.Filter.SetQuery(Rule.TypeQuery);
+    Compiled.bUnlocked = RestoredIds.Contains(Rule.AchievementId);
+
+    if (Rule.Kind == EInteractionAchievementKind::EveryType) {
+      Compiled.NumRequired = FMath::Min(Rule.RequiredTypes.Num(), 64);
+      UE_CLOG(Rule.RequiredTypes.Num() > 64, LogBasicProject, Warning,
+              TEXT("Achievement %s: only the first 64 required types are "
+                   "tracked"),
+              *Rule.AchievementId.ToString());
+    } else if (Rule.Kind == EInteractionAchievementKind::CountWithinWindow &&
+               !Compiled.bUnlocked) {
+      Compiled.Window.SetNumZeroed(Compiled.Rule.TargetCount);
+    }
+
+    RuleIndexById.Add(Rule.AchievementId, Rules.Num() - 1);
+  }
+
+  // Re-index types against the new rule list on next sight
+  RulesByType.Reset();
+  RulesByType.SetNum(FInteractionTypeRegistry::MaxTypes);
+  CompiledTypes.Init(false, FInteractionTypeRegistry::MaxTypes);
+  return FirstRule;
+}
+
+void FInteractionAchievementEngine::CompileType(FInteractionTypeId TypeId) {
+  CompiledTypes[TypeId] = true;
+  const FGameplayTag Tag = FInteractionTypeRegistry::GetTag(TypeId);
+
+  for (int32 RuleIndex = 0; RuleIndex < Rules.Num(); ++RuleIndex) {
+    const FCompiledRule &Compiled = Rules[RuleIndex];
+    if (Compiled.Rule.Kind == EInteractionAchievementKind::EveryType) {
+      const int32 Bit =
+          Compiled.Rule.RequiredTypes.GetGameplayTagArray().IndexOfByKey(Tag);
+      if (Bit != INDEX_NONE && Bit < Compiled.NumRequired) {
+        RulesByType[TypeId].Add({RuleIndex, static_cast<int8>(Bit)});
+      }
+    } else if (Compiled.Filter.Matches(TypeId)) {
+      RulesByType[TypeId].Add({RuleIndex, -1});
+    }
+  }
+}
+
+void FInteractionAchievementEngine::ProcessEvent(
+    const FInteractionEvent &Event,
+    TFunctionRef<bool(FVector &)> GetTargetLocation,
+    TArray<FName, TInlineAllocator<4>> &OutUnlocked) {
+  const FInteractionTypeId TypeId = Event.TypeId;
+  if (TypeId == 0 || TypeId >= FInteractionTypeRegistry::MaxTypes ||
+      Rules.IsEmpty()) {
+    return;
+  }
+  if (!CompiledTypes[TypeId]) {
+    CompileType(TypeId);
+  }
+
+  // Resolved at most once, and only if a zone rule wants it
+  TOptional<bool> bHasLocation;
+  FVector TargetLocation = FVector::ZeroVector;
+
+  for (const FRuleRef &Ref : RulesByType[TypeId]) {
+    FCompiledRule &Compiled = Rules[Ref.RuleIndex];
+    if (Compiled.bUnlocked) {
+      continue;
+    }
+
+    if (Compiled.Rule.bUseZone) {
+      if (!bHasLocation.IsSet()) {
+        bHasLocation = GetTargetLocation(TargetLocation);
+      }
+      if (!bHasLocation.GetValue() ||
+          !Compiled.Rule.Zone.IsInsideOrOn(TargetLocation)) {
+        continue;
+      }
+    }
+
+    switch (Compiled.Rule.Kind) {
+    case EInteractionAchievementKind::Count:
+      ++Compiled.Progress;
+      break;
+
+    case EInteractionAchievementKind::CountWithinWindow: {
+      // Overwrite the oldest timestamp; WindowHead then points at the oldest
+      // of the last TargetCount interactions
+      const int32 WindowSize = Compiled.Window.Num();
+      Compiled.Window[Compiled.WindowHead] = Event.Timestamp;
+      Compiled.WindowHead = (Compiled.WindowHead + 1) % WindowSize;
+      Compiled.NumRecorded = FMath::Min(Compiled.NumRecorded + 1, WindowSize);
+      if (Compiled.NumRecorded == WindowSize &&
+          Event.Timestamp - Compiled.Window[Compiled.WindowHead] <=
+              Compiled.Rule.WindowSeconds) {
+        Compiled.Progress = WindowSize;
+      }
+      break;
+    }
+
+    case EInteractionAchievementKind::EveryType: {
+      const uint64 Bit = 1ull << Ref.RequiredBit;
+      if ((Compiled.SeenTypes & Bit) == 0) {
+        Compiled.SeenTypes |= Bit;
+        ++Compiled.Progress;
+      }
+      break;
+    }
+    }
+
+    CheckUnlocked(Compiled, OutUnlocked);
+  }
+}
+
+void FInteractionAchievementEngine::AddPersistedCount(
+    const FGameplayTag &InteractionType, int32 Count,
+    TArray<FName, TInlineAllocator<4>> &OutUnlocked, int32 FirstRule) {
+  const FInteractionTypeId TypeId =
+      FInteractionTypeRegistry::GetId(InteractionType);
+  if (TypeId == 0 || TypeId >= FInteractionTypeRegistry::MaxTypes ||
+      Rules.IsEmpty() || Count <= 0) {
+    return;
+  }
+  if (!CompiledTypes[TypeId]) {
+    CompileType(TypeId);
+  }
+
+  // Only totals are persisted; windows, type sets and zones are per session
+  for (const FRuleRef &Ref : RulesByType[TypeId]) {
+    FCompiledRule &Compiled = Rules[Ref.RuleIndex];
+    if (Ref.RuleIndex >= FirstRule && !Compiled.bUnlocked &&
+        Compiled.Rule.Kind == EInteractionAchievementKind::Count &&
+        !Compiled.Rule.bUseZone) {
+      Compiled.Progress += Count;
+      CheckUnlocked(Compiled, OutUnlocked);
+    }
+  }
+}
+
+void FInteractionAchievementEngine::CheckUnlocked(
+    FCompiledRule &Compiled, TArray<FName, TInlineAllocator<4>> &OutUnlocked) {
+  if (Compiled.Progress >= Compiled.GetTarget() && Compiled.GetTarget() > 0) {
+    Compiled.bUnlocked = true;
+    Compiled.Window.Empty();
+    OutUnlocked.Add(Compiled.Rule.AchievementId);
+  }
+}
+
+void FInteractionAchievementEngine::RestoreUnlocked(
+    TConstArrayView<FName> AchievementIds) {
+  for (const FName AchievementId : AchievementIds) {
+    RestoredIds.Add(AchievementId);
+    if (const int32 *RuleIndex = RuleIndexById.Find(AchievementId)) {
+      FCompiledRule &Compiled = Rules[*RuleIndex];
+      Compiled.bUnlocked = true;
+      Compiled.Window.Empty();
+    }
+  }
+}
+
+bool FInteractionAchievementEngine::IsUnlocked(FName AchievementId) const {
+  const int32 *RuleIndex = RuleIndexById.Find(AchievementId);
+  return RuleIndex && Rules[*RuleIndex].bUnlocked;
+}
+
+float FInteractionAchievementEngine::GetProgress(FName AchievementId) const {
+  const int32 *RuleIndex = RuleIndexById.Find(AchievementId);
+  if (!RuleIndex) {
+    return 0.0f;
+  }
+  const FCompiledRule &Compiled = Rules[*RuleIndex];
+  if (Compiled.bUnlocked) {
+    return 1.0f;
+  }
+
+  if (Compiled.Rule.Kind == EInteractionAchievementKind::CountWithinWindow &&
+      Compiled.NumRecorded > 0) {
+    // Interactions within WindowSeconds of the newest one
+    const int32 WindowSize = Compiled.Window.Num();
+    const double Newest =
+        Compiled.Window[(Compiled.WindowHead + WindowSize - 1) % WindowSize];
+    int32 NumInWindow = 0;
+    for (int32 i = 0; i < Compiled.NumRecorded; ++i) {
+      const double Timestamp =
+          Compiled.Window[(Compiled.WindowHead + WindowSize - 1 - i) %
+                          WindowSize];
+      if (Newest - Timestamp > Compiled.Rule.WindowSeconds) {
+        break;
+      }
+      ++NumInWindow;
+    }
+    return static_cast<float>(NumInWindow) / WindowSize;
+  }
+
+  return Compiled.GetTarget() > 0
+             ? FMath::Min(1.0f, static_cast<float>(Compiled.Progress) /
+                                    Compiled.GetTarget())
+             : 0.0f;
+}
@@ -0,0 +1,189 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GameplayTagContainer.h"
+#include "InteractionEvent.h"
+#include "InteractionAchievements.generated.h"
+
+/** How an achievement rule advances */
+UENUM(BlueprintType)
+enum class EInteractionAchievementKind : uint8 {
+  /** TargetCount matching interactions in total ("open 50 doors") */
+  Count,
+  /** TargetCount matching interactions within WindowSeconds ("loot 3 chests
+   * within 10 s") */
+  CountWithinWindow,
+  /** At least one interaction of each RequiredTypes tag ("interact with every
+   * type in a zone") */
+  EveryType,
+};
+
+/**
+ * One data-defined achievement rule
+ * 데이터로 정의하는 업적 규칙
+ */
+USTRUCT(BlueprintType)
+struct BASICPROJECT_API FInteractionAchievementRule {
+  GENERATED_BODY()
+
+  /** Achievement id reported by OnAchievementUnlocked */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Achievement")
+  FName AchievementId;
+
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Achievement")
+  EInteractionAchievementKind Kind = EInteractionAchievementKind::Count;
+
+  /** Interaction types that count (empty = all), for Count and
+   * CountWithinWindow */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Achievement",
+            meta = (Categories = "Interaction",
+                    EditCondition =
+                        "Kind != EInteractionAchievementKind::EveryType"))
+  FGameplayTagQuery TypeQuery;
+
+  /** Exact types that must each be seen once (up to 64), for EveryType */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Achievement",
+            meta = (Categories = "Interaction",
+                    EditCondition =
+                        "Kind == EInteractionAchievementKind::EveryType"))
+  FGameplayTagContainer RequiredTypes;
+
+  /** Interactions needed (CountWithinWindow keeps this many timestamps) */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Achievement",
+            meta = (ClampMin = "1", ClampMax = "256",
+                    EditCondition =
+                        "Kind != EInteractionAchievementKind::EveryType"))
+  int32 TargetCount = 1;
+
+  /** Window length in seconds for CountWithinWindow */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Achievement",
+            meta = (ClampMin = "0.0",
+                    EditCondition =
+                        "Kind == EInteractionAchievementKind::CountWithinWindow"))
+  float WindowSeconds = 10.0f;
+
+  /** Only count interactions whose target lies inside Zone */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Achievement")
+  bool bUseZone = false;
+
+  /** World-space box of the zone */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Achievement",
+            meta = (EditCondition = "bUseZone"))
+  FBox Zone = FBox(ForceInit);
+};
+
+/**
+ * Data asset holding a list of achievement rules
+ * 업적 규칙 목록 데이터 에셋
+ */
+UCLASS(BlueprintType)
+class BASICPROJECT_API UInteractionAchievementSet : public UPrimaryDataAsset {
+  GENERATED_BODY()
+
+public:
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Achievement")
+  TArray<FInteractionAchievementRule> Rules;
+};
+
+/**
+ * Incremental achievement evaluation on the interaction stream
+ * Rules compile to small state machines (a counter, a ring of TargetCount
+ * timestamps, or a bitmask of required types). The rules that care about a
+ * type are indexed the first time that type id is seen, so an event only
+ * touches its own rules: no polling, and memory is fixed per rule.
+ *
+ * 상호작용 스트림 기반 증분 업적 평가기
+ * 규칙은 작은 상태 기계(카운터, 타임스탬프 링, 필수 타입 비트마스크)로 컴파일되고
+ * 타입 Id별로 색인되어 이벤트는 해당 규칙만 갱신 - 폴링 없음, 규칙당 고정 메모리
+ */
+class BASICPROJECT_API FInteractionAchievementEngine {
+public:
+  /**
+   * Compile and add rules (game thread); ids already present are skipped
+   * @return Index of the first added rule, for AddPersistedCount
+   */
+  int32 AddRules(TConstArrayView<FInteractionAchievementRule> NewRules);
+
+  bool HasRules() const { return !Rules.IsEmpty(); }
+
+  /**
+   * Advance the rules matching an event's type
+   * @param GetTargetLocation Resolves the target location for zone rules
+   * (called at most once, only if a zone rule matches the type)
+   * @param OutUnlocked Achievement ids unlocked by this event
+   */
+  void ProcessEvent(const FInteractionEvent &Event,
+                    TFunctionRef<bool(FVector &)> GetTargetLocation,
+                    TArray<FName, TInlineAllocator<4>> &OutUnlocked);
+
+  /**
+   * Add counts the rules have not seen to Count rules without a zone
+   * @param FirstRule Only rules from this index on (see AddRules)
+   */
+  void AddPersistedCount(const FGameplayTag &InteractionType, int32 Count,
+                         TArray<FName, TInlineAllocator<4>> &OutUnlocked,
+                         int32 FirstRule = 0);
+
+  /**
+   * Mark achievements unlocked in an earlier session, without reporting them
+   * Rules added later with one of these ids start unlocked as well.
+   */
+  void RestoreUnlocked(TConstArrayView<FName> AchievementIds);
+
+  bool IsUnlocked(FName AchievementId) const;
+
+  /** Progress towards unlocking, 0..1 */
+  float GetProgress(FName AchievementId) const;
+
+private:
+  struct FCompiledRule {
+    FInteractionAchievementRule Rule;
+    FInteractionTypeFilter Filter;
+
+    /** Count, required types seen, or TargetCount once a window filled */
+    int32 Progress = 0;
+
+    /** Required types seen (EveryType) */
+    uint64 SeenTypes = 0;
+    int32 NumRequired = 0;
+
+    /** Last TargetCount timestamps, oldest at WindowHead (CountWithinWindow) */
+    TArray<double> Window;
+    int32 WindowHead = 0;
+    int32 NumRecorded = 0;
+
+    bool bUnlocked = false;
+
+    int32 GetTarget() const {
+      return Rule.Kind == EInteractionAchievementKind::EveryType
+                 ? NumRequired
+                 : Rule.TargetCount;
+    }
+  };
+
+  /** A rule interested in a type; RequiredBit is its EveryType bit or -1 */
+  struct FRuleRef {
+    int32 RuleIndex = 0;
+    int8 RequiredBit = -1;
+  };
+
+  /** Index the rules that care about a type id */
+  void CompileType(FInteractionTypeId TypeId);
+
+  /** Mark a rule unlocked once it reached its target */
+  void CheckUnlocked(FCompiledRule &Compiled,
+                     TArray<FName, TInlineAllocator<4>> &OutUnlocked);
+
+  TArray<FCompiledRule> Rules;
+  TMap<FName, int32> RuleIndexById;
+
+  /** Ids passed to RestoreUnlocked, for rules added afterwards */
+  TSet<FName> RestoredIds;
+
+  /** Rules per type id, built on first sight of the type */
+  TArray<TArray<FRuleRef, TInlineAllocator<2>>> RulesByType;
+  TBitArray<> CompiledTypes;
+};
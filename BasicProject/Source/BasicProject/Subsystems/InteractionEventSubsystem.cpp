@@ -1,39 +1,323 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "InteractionEventSubsystem.h"
+#include "BasicProject.h"
 #include "Engine/GameInstance.h"
+#include "Engine/World.h"
 #include "GlobalInteractionSubsystem.h"
+#include "HAL/IConsoleManager.h"
+#include "InteractionProfiling.h"
+#include "Misc/CommandLine.h"
 
+namespace InteractionEventSubsystem {
+static FAutoConsoleCommandWithWorldAndArgs StartJournalCommand(
+    TEXT("Interaction.Journal.Start"),
+    TEXT("Start journaling routed interaction events. Args: [FileName]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+        [](const TArray<FString> &Args, UWorld *World) {
+          if (UInteractionEventSubsystem *Subsystem =
+                  World ? World->GetSubsystem<UInteractionEventSubsystem>()
+                        : nullptr) {
+            Subsystem->StartJournal(Args.Num() > 0 ? Args[0] : FString());
+          }
+        }));
+
+static FAutoConsoleCommandWithWorldAndArgs StopJournalCommand(
+    TEXT("Interaction.Journal.Stop"),
+    TEXT("Stop journaling routed interaction events."),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+        [](const TArray<FString> &Args, UWorld *World) {
+          if (UInteractionEventSubsystem *Subsystem =
+                  World ? World->GetSubsystem<UInteractionEventSubsystem>()
+                        : nullptr) {
+            Subsystem->StopJournal();
+          }
+        }));
+
+static FAutoConsoleCommandWithWorldAndArgs ReplayJournalCommand(
+    TEXT("Interaction.Journal.Replay"),
+    TEXT("Replay an interaction journal and report routing cost. Args: "
+         "FileName [realtime]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+        [](const TArray<FString> &Args, UWorld *World) {
+          UInteractionEventSubsystem *Subsystem =
+              World ? World->GetSubsystem<UInteractionEventSubsystem>()
+                    : nullptr;
+          if (Subsystem && Args.Num() > 0) {
+            const bool bRealTime =
+                Args.Num() > 1 && Args[1].Equals(TEXT("realtime"));
+            Subsystem->ReplayJournal(Args[0], bRealTime);
+          }
+        }));
+
+/** Insights label for a native subscription (bound object, if any) */
+static FString
+GetHandlerName(const FOnInteractionEventNative::FDelegate &Delegate) {
+  const UObject *Object = Delegate.GetUObject();
+  return Object ? FString::Printf(TEXT("Handler %s"), *Object->GetName())
+                : FString(TEXT("Handler (native)"));
+}
+} // namespace InteractionEventSubsystem
 
 void UInteractionEventSubsystem::Initialize(
     FSubsystemCollectionBase &Collection) {
   Super::Initialize(Collection);
   WorldInteractionCount = 0;
 
-  // Register this subsystem as the global interaction router
+  // Register this subsystem as the interaction router of its world
   FInteractionRouterRegistry::SetRouter(
-      TScriptInterface<IInteractionRouter>(this));
+      GetWorld(), TScriptInterface<IInteractionRouter>(this));
+
+  // -InteractionJournal=<File> records from the first event
+  FString JournalFile;
+  if (FParse::Value(FCommandLine::Get(), TEXT("InteractionJournal="),
+                    JournalFile) &&
+      GetWorld() && GetWorld()->IsGameWorld()) {
+    StartJournal(JournalFile);
+  }
 }
 
 void UInteractionEventSubsystem::Deinitialize() {
+  if (ActiveReplay) {
+    FinishReplay();
+  }
+  StopJournal();
+
   // Unregister router
-  FInteractionRouterRegistry::SetRouter(nullptr);
+  FInteractionRouterRegistry::SetRouter(GetWorld(), nullptr);
   OnInteractionReceived.Clear();
+  OnInteractionReceivedNative.Clear();
+  FilteredSubscriptions.Empty();
+  PendingSubscriptions.Empty();
   Super::Deinitialize();
 }
 
-void UInteractionEventSubsystem::RouteInteraction(
-    FInteractionEventData &EventData) {
+void UInteractionEventSubsystem::RouteInteraction(FInteractionEvent &Event) {
+  LLM_SCOPE_BYTAG(Interaction_Routing);
+  const uint64 RouteStartCycles = FPlatformTime::Cycles64();
   WorldInteractionCount++;
 
-  // Broadcast to world-level listeners
-  OnInteractionReceived.Broadcast(EventData);
+  // Replayed events are not journaled again
+  if (JournalWriter && !ActiveReplay) {
+    JournalWriter->Append(Event);
+  }
+
+  // Broadcast to world-level listeners; the Blueprint view is built lazily
+  // and shared with the global subsystem
+  TOptional<FInteractionEventData> EventView;
+  {
+    INTERACTION_SCOPE_CYCLE_COUNTER(STAT_InteractionHandlers);
+    if (OnInteractionReceivedNative.IsBound()) {
+      TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(OnInteractionReceivedNative,
+                                               InteractionChannel);
+      OnInteractionReceivedNative.Broadcast(Event);
+    }
+
+    BroadcastFiltered(Event, EventView);
+  }
+
+  if (OnInteractionReceived.IsBound()) {
+    INTERACTION_SCOPE_CYCLE_COUNTER(STAT_InteractionHandlers);
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(OnInteractionReceived,
+                                             InteractionChannel);
+    if (!EventView.IsSet()) {
+      EventView.Emplace(Event.ToEventData());
+    }
+    FInteractionEventData &EventData = *EventView;
+    EventData.bHandled = Event.IsHandled();
+    OnInteractionReceived.Broadcast(EventData);
+    Event.SetHandled(EventData.bHandled);
+  }
+  const uint64 ListenersEndCycles = FPlatformTime::Cycles64();
 
   // Forward to global subsystem for game-wide tracking
+  CSV_SCOPED_TIMING_STAT(Interaction, GlobalTracking);
+  TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(GlobalTracking, InteractionChannel);
   if (UGameInstance *GI = GetWorld()->GetGameInstance()) {
     if (UGlobalInteractionSubsystem *GlobalSub =
             GI->GetSubsystem<UGlobalInteractionSubsystem>()) {
-      GlobalSub->TrackInteraction(EventData);
+      GlobalSub->TrackRoutedInteraction(Event, EventView, RouteStartCycles);
+    }
+  }
+
+  if (ActiveReplay) {
+    ActiveReplay->Profile.WorldListenerCycles +=
+        ListenersEndCycles - RouteStartCycles;
+    ActiveReplay->Profile.GlobalTrackingCycles +=
+        FPlatformTime::Cycles64() - ListenersEndCycles;
+  }
+}
+
+FDelegateHandle UInteractionEventSubsystem::Subscribe(
+    const FGameplayTagQuery &TypeQuery,
+    FOnInteractionEventNative::FDelegate &&Delegate) {
+  FFilteredSubscription Subscription;
+  Subscription.Filter.SetQuery(TypeQuery);
+  Subscription.Delegate = MoveTemp(Delegate);
+  Subscription.Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle);
+  const FDelegateHandle Handle = Subscription.Handle;
+  AddSubscription(MoveTemp(Subscription));
+  return Handle;
+}
+
+void UInteractionEventSubsystem::Unsubscribe(FDelegateHandle Handle) {
+  RemoveSubscriptions([Handle](const FFilteredSubscription &Subscription) {
+    return Subscription.Handle == Handle;
+  });
+}
+
+void UInteractionEventSubsystem::SubscribeFiltered(
+    const FGameplayTagQuery &TypeQuery, FOnFilteredInteractionEvent Delegate) {
+  FFilteredSubscription Subscription;
+  Subscription.Filter.SetQuery(TypeQuery);
+  Subscription.DynamicDelegate = MoveTemp(Delegate);
+  AddSubscription(MoveTemp(Subscription));
+}
+
+void UInteractionEventSubsystem::UnsubscribeFiltered(
+    FOnFilteredInteractionEvent Delegate) {
+  RemoveSubscriptions([&Delegate](const FFilteredSubscription &Subscription) {
+    return Subscription.DynamicDelegate.IsBound() &&
+           Subscription.DynamicDelegate == Delegate;
+  });
+}
+
+void UInteractionEventSubsystem::AddSubscription(
+    FFilteredSubscription &&Subscription) {
+  LLM_SCOPE_BYTAG(Interaction_Routing);
+  // Handlers may subscribe while we iterate; those start with the next event
+  if (bDispatchingFiltered) {
+    PendingSubscriptions.Add(MoveTemp(Subscription));
+  } else {
+    FilteredSubscriptions.Add(MoveTemp(Subscription));
+  }
+}
+
+void UInteractionEventSubsystem::RemoveSubscriptions(
+    TFunctionRef<bool(const FFilteredSubscription &)> Predicate) {
+  for (FFilteredSubscription &Subscription : FilteredSubscriptions) {
+    if (Predicate(Subscription)) {
+      Subscription.bRemoved = true;
+    }
+  }
+  PendingSubscriptions.RemoveAll(Predicate);
+
+  if (!bDispatchingFiltered) {
+    FilteredSubscriptions.RemoveAll(
+        [](const FFilteredSubscription &Subscription) {
+          return Subscription.bRemoved;
+        });
+  }
+}
+
+void UInteractionEventSubsystem::BroadcastFiltered(
+    FInteractionEvent &Event, TOptional<FInteractionEventData> &EventView) {
+  if (FilteredSubscriptions.IsEmpty()) {
+    return;
+  }
+
+  {
+    TGuardValue<bool> DispatchGuard(bDispatchingFiltered, true);
+    for (const FFilteredSubscription &Subscription : FilteredSubscriptions) {
+      if (Subscription.bRemoved || !Subscription.Filter.Matches(Event.TypeId)) {
+        continue;
+      }
+
+      if (Subscription.Delegate.IsBound()) {
+        INTERACTION_HANDLER_TRACE_SCOPE(
+            InteractionEventSubsystem::GetHandlerName(Subscription.Delegate));
+        Subscription.Delegate.Execute(Event);
+      }
+
+      if (Subscription.DynamicDelegate.IsBound()) {
+        INTERACTION_HANDLER_TRACE_SCOPE(
+            Subscription.DynamicDelegate.GetFunctionName().ToString());
+        if (!EventView.IsSet()) {
+          EventView.Emplace(Event.ToEventData());
+        }
+        EventView->bHandled = Event.IsHandled();
+        Subscription.DynamicDelegate.Execute(*EventView);
+        Event.SetHandled(EventView->bHandled);
+      }
     }
   }
+
+  // Apply changes made by handlers during dispatch
+  FilteredSubscriptions.RemoveAll([](const FFilteredSubscription &Subscription) {
+    return Subscription.bRemoved;
+  });
+  if (!PendingSubscriptions.IsEmpty()) {
+    FilteredSubscriptions.Append(MoveTemp(PendingSubscriptions));
+    PendingSubscriptions.Reset();
+  }
+}
+
+void UInteractionEventSubsystem::StartJournal(const FString &FileName) {
+  StopJournal();
+
+  JournalWriter = MakeUnique<FInteractionJournalWriter>(
+      InteractionJournal::ResolveJournalPath(FileName));
+  UE_LOG(LogBasicProject, Display, TEXT("Interaction journal started: %s"),
+         *JournalWriter->GetPath());
+}
+
+void UInteractionEventSubsystem::StopJournal() {
+  if (JournalWriter) {
+    UE_LOG(LogBasicProject, Display,
+           TEXT("Interaction journal stopped: %s (%d events)"),
+           *JournalWriter->GetPath(), JournalWriter->GetNumEvents());
+    JournalWriter.Reset();
+  }
+}
+
+bool UInteractionEventSubsystem::ReplayJournal(const FString &FileName,
+                                               bool bRealTime) {
+  if (ActiveReplay) {
+    UE_LOG(LogBasicProject, Warning,
+           TEXT("Interaction journal replay already running"));
+    return false;
+  }
+
+  FInteractionJournalReader Journal;
+  const FString Path = InteractionJournal::ResolveJournalPath(FileName);
+  if (!Journal.Load(Path)) {
+    UE_LOG(LogBasicProject, Warning,
+           TEXT("Failed to load interaction journal: %s"), *Path);
+    return false;
+  }
+
+  ActiveReplay =
+      MakeUnique<FInteractionJournalReplay>(MoveTemp(Journal), bRealTime);
+
+  if (!bRealTime) {
+    ActiveReplay->Dispatch(0.0);
+    FinishReplay();
+    return true;
+  }
+
+  ReplayElapsedSeconds = 0.0;
+  ReplayTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+      FTickerDelegate::CreateUObject(
+          this, &UInteractionEventSubsystem::HandleReplayTick));
+  return true;
+}
+
+bool UInteractionEventSubsystem::HandleReplayTick(float DeltaTime) {
+  ReplayElapsedSeconds += DeltaTime;
+  if (ActiveReplay && !ActiveReplay->Dispatch(ReplayElapsedSeconds)) {
+    return true;
+  }
+
+  FinishReplay();
+  return false;
+}
+
+void UInteractionEventSubsystem::FinishReplay() {
+  FTSTicker::GetCoreTicker().RemoveTicker(ReplayTickerHandle);
+  ReplayTickerHandle.Reset();
+
+  if (ActiveReplay) {
+    ActiveReplay->LogReport(OnInteractionReceived.GetAllObjects().Num());
+    ActiveReplay.Reset();
+  }
 }
@@ -3,11 +3,18 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "GameplayTagContainer.h"
+#include "InteractionJournal.h"
 #include "InteractionRouter.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "InteractionEventSubsystem.generated.h"
 
 
+/** Blueprint delegate for filtered subscriptions */
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnFilteredInteractionEvent,
+                                  FInteractionEventData &, EventData);
+
 /**
  * World Subsystem for routing interaction events within a level
  * Implements IInteractionRouter to receive events from InteractionSystem
@@ -30,18 +37,112 @@ public:
   //~ End USubsystem Interface
 
   //~ Begin IInteractionRouter Interface
-  virtual void RouteInteraction(FInteractionEventData &EventData) override;
+  virtual void RouteInteraction(FInteractionEvent &Event) override;
   //~ End IInteractionRouter Interface
 
-  /** Delegate for systems to bind to receive interaction events */
+  /**
+   * Delegate for systems to bind to receive interaction events
+   * The Blueprint-facing event view is only built when this is bound
+   */
   UPROPERTY(BlueprintAssignable, Category = "Interaction")
   FOnInteractionEvent OnInteractionReceived;
 
+  /** Native delegate for C++ listeners working on the compact event */
+  FOnInteractionEventNative OnInteractionReceivedNative;
+
+  //~ Filtered subscriptions (query compiled once to a type id bitmask)
+
+  /**
+   * Receive only events whose type matches a query (e.g. any Interaction.Door)
+   * @return Handle for Unsubscribe
+   */
+  FDelegateHandle Subscribe(const FGameplayTagQuery &TypeQuery,
+                            FOnInteractionEventNative::FDelegate &&Delegate);
+
+  /** Remove a native subscription */
+  void Unsubscribe(FDelegateHandle Handle);
+
+  /** Blueprint variant of Subscribe */
+  UFUNCTION(BlueprintCallable, Category = "Interaction",
+            meta = (DisplayName = "Subscribe Filtered"))
+  void SubscribeFiltered(const FGameplayTagQuery &TypeQuery,
+                         FOnFilteredInteractionEvent Delegate);
+
+  /** Remove every filtered subscription bound to a Blueprint delegate */
+  UFUNCTION(BlueprintCallable, Category = "Interaction",
+            meta = (DisplayName = "Unsubscribe Filtered"))
+  void UnsubscribeFiltered(FOnFilteredInteractionEvent Delegate);
+
   /** Get world interaction count for this session */
   UFUNCTION(BlueprintPure, Category = "Interaction")
   int32 GetWorldInteractionCount() const { return WorldInteractionCount; }
 
+  //~ Journal / replay (performance regression runs)
+
+  /** Start appending every routed event to a binary journal */
+  void StartJournal(const FString &FileName);
+
+  /** Stop journaling and flush the file */
+  void StopJournal();
+
+  /** Check if routed events are currently being journaled */
+  bool IsJournaling() const { return JournalWriter.IsValid(); }
+
+  /**
+   * Replay a journal through the router and log throughput and per-stage cost
+   * @param FileName Journal file (relative names resolve to Saved/Interaction/Journals)
+   * @param bRealTime Pace events by their recorded timestamps
+   */
+  bool ReplayJournal(const FString &FileName, bool bRealTime);
+
 private:
+  /** Subscription with its compiled type filter */
+  struct FFilteredSubscription {
+    FInteractionTypeFilter Filter;
+    FOnInteractionEventNative::FDelegate Delegate;
+    FOnFilteredInteractionEvent DynamicDelegate;
+    FDelegateHandle Handle;
+    bool bRemoved = false;
+  };
+
+  /** Add a subscription (deferred while dispatching) */
+  void AddSubscription(FFilteredSubscription &&Subscription);
+
+  /** Remove matching subscriptions (deferred while dispatching) */
+  void RemoveSubscriptions(
+      TFunctionRef<bool(const FFilteredSubscription &)> Predicate);
+
+  /** Dispatch an event to matching filtered subscriptions */
+  void BroadcastFiltered(FInteractionEvent &Event,
+                         TOptional<FInteractionEventData> &EventView);
+
+  /** Filtered subscriptions */
+  TArray<FFilteredSubscription> FilteredSubscriptions;
+
+  /** Subscriptions added while dispatching, appended afterwards */
+  TArray<FFilteredSubscription> PendingSubscriptions;
+
+  /** True while BroadcastFiltered is iterating */
+  bool bDispatchingFiltered = false;
+
+  /** Drive a real-time replay */
+  bool HandleReplayTick(float DeltaTime);
+
+  /** Finish the active replay and log its report */
+  void FinishReplay();
+
   /** Count of interactions in this world */
   int32 WorldInteractionCount = 0;
+
+  /** Active journal writer (null when not journaling) */
+  TUniquePtr<FInteractionJournalWriter> JournalWriter;
+
+  /** Active replay (null when not replaying) */
+  TUniquePtr<FInteractionJournalReplay> ActiveReplay;
+
+  /** Ticker driving a real-time replay */
+  FTSTicker::FDelegateHandle ReplayTickerHandle;
+
+  /** Time accumulated by the real-time replay */
+  double ReplayElapsedSeconds = 0.0;
 };
@@ -0,0 +1,308 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "InteractionJournal.h"
+#include "BasicProject.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "InteractionRouter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/SoftObjectPath.h"
+
+FString InteractionJournal::GetJournalDir() {
+  return FPaths::ProjectSavedDir() / TEXT("Interaction") / TEXT("Journals");
+}
+
+FString InteractionJournal::ResolveJournalPath(const FString &FileName) {
+  if (FileName.IsEmpty()) {
+    return GetJournalDir() /
+           FString::Printf(TEXT("Journal_%s.ijnl"),
+                           *FDateTime::Now().ToString());
+  }
+  return FPaths::IsRelative(FileName) ? GetJournalDir() / FileName : FileName;
+}
+
+//~ FInteractionJournalWriter
+
+FInteractionJournalWriter::FInteractionJournalWriter(const FString &InPath)
+    : Path(InPath) {
+  StartSeconds = FPlatformTime::Seconds();
+  StartFrame = static_cast<uint32>(GFrameCounter);
+
+  FMemoryWriter Writer(Buffer, false, true);
+  uint32 Magic = InteractionJournal::FileMagic;
+  uint16 Version = InteractionJournal::FileVersion;
+  Writer << Magic;
+  Writer << Version;
+
+  LastTask = Pipe.Launch(
+      TEXT("OpenInteractionJournal"),
+      [this]() {
+        FileWriter = MakeShareable(IFileManager::Get().CreateFileWriter(*Path));
+      },
+      UE::Tasks::ETaskPriority::BackgroundNormal);
+}
+
+FInteractionJournalWriter::~FInteractionJournalWriter() {
+  Flush();
+
+  LastTask = Pipe.Launch(
+      TEXT("CloseInteractionJournal"),
+      [this]() {
+        if (FileWriter) {
+          FileWriter->Close();
+          FileWriter.Reset();
+        }
+      },
+      UE::Tasks::ETaskPriority::BackgroundNormal);
+  LastTask.Wait();
+}
+
+void FInteractionJournalWriter::Append(const FInteractionEvent &Event) {
+  // Ids first: they may emit object/type records that must precede the event
+  uint32 InstigatorId = GetObjectId(Event.Instigator);
+  uint32 TargetComponentId = GetObjectId(Event.TargetComponent);
+  uint32 TypeId = GetTypeId(Event.GetInteractionType().GetTagName());
+
+  double Timestamp = Event.Timestamp - StartSeconds;
+  uint32 FrameOffset = Event.FrameNumber - StartFrame;
+
+  FMemoryWriter Writer(Buffer, false, true);
+  uint8 Tag = static_cast<uint8>(InteractionJournal::ERecord::Event);
+  Writer << Tag;
+  Writer << Timestamp;
+  Writer.SerializeIntPacked(FrameOffset);
+  Writer.SerializeIntPacked(InstigatorId);
+  Writer.SerializeIntPacked(TargetComponentId);
+  Writer.SerializeIntPacked(TypeId);
+  ++NumEvents;
+
+  if (Buffer.Num() >= FlushThresholdBytes) {
+    Flush();
+  }
+}
+
+void FInteractionJournalWriter::Flush() {
+  if (Buffer.IsEmpty()) {
+    return;
+  }
+
+  LastTask = Pipe.Launch(
+      TEXT("WriteInteractionJournal"),
+      [this, Bytes = MoveTemp(Buffer)]() mutable {
+        if (FileWriter) {
+          FileWriter->Serialize(Bytes.GetData(), Bytes.Num());
+        }
+      },
+      UE::Tasks::ETaskPriority::BackgroundNormal);
+  Buffer.Reset();
+}
+
+uint32 FInteractionJournalWriter::GetObjectId(FObjectKey ObjectKey) {
+  if (ObjectKey == FObjectKey()) {
+    return 0;
+  }
+
+  if (const uint32 *Existing = ObjectIds.Find(ObjectKey)) {
+    return *Existing;
+  }
+
+  // Objects are resolved once, the first time they appear. PIE prefixes are
+  // stripped so journals replay in any world instance
+  const UObject *Object = ObjectKey.ResolveObjectPtr();
+  uint32 ObjectId = ObjectIds.Num() + 1;
+  FString ObjectPath =
+      Object ? UWorld::RemovePIEPrefix(Object->GetPathName()) : FString();
+  ObjectIds.Add(ObjectKey, ObjectId);
+
+  FMemoryWriter Writer(Buffer, false, true);
+  uint8 Tag = static_cast<uint8>(InteractionJournal::ERecord::Object);
+  Writer << Tag;
+  Writer.SerializeIntPacked(ObjectId);
+  Writer << ObjectPath;
+  return ObjectId;
+}
+
+uint32 FInteractionJournalWriter::GetTypeId(FName InteractionType) {
+  if (const uint32 *Existing = TypeIds.Find(InteractionType)) {
+    return *Existing;
+  }
+
+  uint32 TypeId = TypeIds.Num() + 1;
+  FString TypeName = InteractionType.ToString();
+  TypeIds.Add(InteractionType, TypeId);
+
+  FMemoryWriter Writer(Buffer, false, true);
+  uint8 Tag = static_cast<uint8>(InteractionJournal::ERecord::Type);
+  Writer << Tag;
+  Writer.SerializeIntPacked(TypeId);
+  Writer << TypeName;
+  return TypeId;
+}
+
+//~ FInteractionJournalReader
+
+bool FInteractionJournalReader::Load(const FString &Path) {
+  TArray<uint8> Bytes;
+  if (!FFileHelper::LoadFileToArray(Bytes, *Path)) {
+    return false;
+  }
+
+  FMemoryReader Reader(Bytes);
+  uint32 Magic = 0;
+  uint16 Version = 0;
+  Reader << Magic;
+  Reader << Version;
+  if (Magic != InteractionJournal::FileMagic ||
+      Version != InteractionJournal::FileVersion) {
+    UE_LOG(LogBasicProject, Warning,
+           TEXT("Interaction journal '%s' has an unsupported header"), *Path);
+    return false;
+  }
+
+  ObjectPaths.Reset();
+  TypeNames.Reset();
+  Events.Reset();
+  ObjectPaths.AddDefaulted();
+  TypeNames.AddDefaulted();
+
+  while (!Reader.AtEnd() && !Reader.IsError()) {
+    uint8 Tag = 0;
+    Reader << Tag;
+
+    switch (static_cast<InteractionJournal::ERecord>(Tag)) {
+    case InteractionJournal::ERecord::Object: {
+      uint32 ObjectId = 0;
+      FString ObjectPath;
+      Reader.SerializeIntPacked(ObjectId);
+      Reader << ObjectPath;
+      // The writer numbers objects 1, 2, ... as it first records them, so
+      // any other id means a damaged file (and must not size the table)
+      if (Reader.IsError() ||
+          ObjectId != static_cast<uint32>(ObjectPaths.Num())) {
+        UE_LOG(LogBasicProject, Warning,
+               TEXT("Interaction journal '%s' has an out of order object id "
+                    "%u"),
+               *Path, ObjectId);
+        return false;
+      }
+      ObjectPaths.Add(MoveTemp(ObjectPath));
+      break;
+    }
+    case InteractionJournal::ERecord::Type: {
+      uint32 TypeId = 0;
+      FString TypeName;
+      Reader.SerializeIntPacked(TypeId);
+      Reader << TypeName;
+      if (Reader.IsError() || TypeId != static_cast<uint32>(TypeNames.Num())) {
+        UE_LOG(LogBasicProject, Warning,
+               TEXT("Interaction journal '%s' has an out of order type id %u"),
+               *Path, TypeId);
+        return false;
+      }
+      TypeNames.Add(FName(*TypeName));
+      break;
+    }
+    case InteractionJournal::ERecord::Event: {
+      FInteractionJournalEvent &Event = Events.AddDefaulted_GetRef();
+      Reader << Event.Timestamp;
+      Reader.SerializeIntPacked(Event.FrameOffset);
+      Reader.SerializeIntPacked(Event.InstigatorId);
+      Reader.SerializeIntPacked(Event.TargetComponentId);
+      Reader.SerializeIntPacked(Event.TypeId);
+      break;
+    }
+    default:
+      UE_LOG(LogBasicProject, Warning,
+             TEXT("Interaction journal '%s' has an unknown record %d"), *Path,
+             Tag);
+      return false;
+    }
+  }
+
+  return !Reader.IsError();
+}
+
+//~ FInteractionJournalReplay
+
+FInteractionJournalReplay::FInteractionJournalReplay(
+    FInteractionJournalReader &&InJournal, bool bInRealTime)
+    : Journal(MoveTemp(InJournal)), bRealTime(bInRealTime) {
+  // Resolve every stable id once up front so dispatch only indexes arrays
+  ResolvedObjects.SetNum(Journal.ObjectPaths.Num());
+  for (int32 ObjectId = 1; ObjectId < Journal.ObjectPaths.Num(); ++ObjectId) {
+    FSoftObjectPath ObjectPath(Journal.ObjectPaths[ObjectId]);
+#if WITH_EDITOR
+    ObjectPath.FixupForPIE();
+#endif
+    ResolvedObjects[ObjectId] = ObjectPath.ResolveObject();
+    if (!ResolvedObjects[ObjectId].IsValid()) {
+      ++NumUnresolvedObjects;
+    }
+  }
+
+  ResolvedTypeIds.SetNumZeroed(Journal.TypeNames.Num());
+  for (int32 TypeId = 1; TypeId < Journal.TypeNames.Num(); ++TypeId) {
+    ResolvedTypeIds[TypeId] = FInteractionTypeRegistry::GetId(
+        FGameplayTag::RequestGameplayTag(Journal.TypeNames[TypeId], false));
+  }
+  StartSeconds = FPlatformTime::Seconds();
+}
+
+bool FInteractionJournalReplay::Dispatch(double ElapsedSeconds) {
+  while (NextEvent < Journal.Events.Num()) {
+    const FInteractionJournalEvent &Event = Journal.Events[NextEvent];
+    if (bRealTime && Event.Timestamp > ElapsedSeconds) {
+      return false;
+    }
+
+    FInteractionEvent RoutedEvent;
+    RoutedEvent.Instigator = FObjectKey(ResolveObject(Event.InstigatorId));
+    RoutedEvent.TargetComponent =
+        FObjectKey(ResolveObject(Event.TargetComponentId));
+    RoutedEvent.Timestamp = FPlatformTime::Seconds();
+    RoutedEvent.FrameNumber = static_cast<uint32>(GFrameCounter);
+    RoutedEvent.TypeId = ResolvedTypeIds.IsValidIndex(Event.TypeId)
+                             ? ResolvedTypeIds[Event.TypeId]
+                             : 0;
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    FInteractionRouterRegistry::Route(RoutedEvent);
+    RouteCycles += FPlatformTime::Cycles64() - StartCycles;
+
+    ++NextEvent;
+  }
+  return true;
+}
+
+void FInteractionJournalReplay::LogReport(int32 NumWorldListeners) const {
+  const int32 NumEvents = FMath::Max(NextEvent, 1);
+  const double RouteMs = FPlatformTime::ToMilliseconds64(RouteCycles);
+  const double WallMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+  const double ToMicrosPerEvent = 1000.0 / NumEvents;
+
+  UE_LOG(LogBasicProject, Display,
+         TEXT("Interaction journal replay (%s): %d events, %.2f ms routing, "
+              "%.2f ms wall, %.0f events/s"),
+         bRealTime ? TEXT("real-time") : TEXT("full speed"), NextEvent,
+         RouteMs, WallMs, RouteMs > 0.0 ? NextEvent / (RouteMs / 1000.0) : 0.0);
+  UE_LOG(LogBasicProject, Display, TEXT("  Route: %.3f us/event"),
+         RouteMs * ToMicrosPerEvent);
+  UE_LOG(LogBasicProject, Display,
+         TEXT("  World listeners (%d bound): %.3f us/event"),
+         NumWorldListeners,
+         FPlatformTime::ToMilliseconds64(Profile.WorldListenerCycles) *
+             ToMicrosPerEvent);
+  UE_LOG(LogBasicProject, Display, TEXT("  Global tracking: %.3f us/event"),
+         FPlatformTime::ToMilliseconds64(Profile.GlobalTrackingCycles) *
+             ToMicrosPerEvent);
+  UE_LOG(LogBasicProject, Display, TEXT("  Unresolved objects: %d / %d"),
+         NumUnresolvedObjects, FMath::Max(Journal.ObjectPaths.Num() - 1, 0));
+}
+
+UObject *FInteractionJournalReplay::ResolveObject(uint32 ObjectId) const {
+  return ResolvedObjects.IsValidIndex(ObjectId) ? ResolvedObjects[ObjectId].Get()
+                                                : nullptr;
+}
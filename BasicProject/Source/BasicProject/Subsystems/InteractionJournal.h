@@ -0,0 +1,178 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InteractionEvent.h"
+#include "Tasks/Pipe.h"
+#include "Tasks/Task.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * Interaction journal file format
+ * Header: magic, version, then a stream of tagged records. Objects and types
+ * are written once as (Id, Name) records and referenced by packed Id from
+ * event records, so events stay a handful of bytes each.
+ *
+ * 상호작용 저널 파일 포맷
+ * 헤더 다음 태그 레코드 스트림 - 오브젝트/타입은 (Id, 이름)으로 한 번만 기록,
+ * 이벤트는 패킹된 Id로 참조
+ */
+namespace InteractionJournal {
+/** File identifier ("IJNL") */
+constexpr uint32 FileMagic = 0x4C4E4A49;
+
+/** Bump when the record layout changes */
+constexpr uint16 FileVersion = 2;
+
+/** Record tags */
+enum class ERecord : uint8 { Object = 1, Type = 2, Event = 3 };
+
+/** Directory used for relative journal file names */
+BASICPROJECT_API FString GetJournalDir();
+
+/** Resolve a user supplied journal name to a full path */
+BASICPROJECT_API FString ResolveJournalPath(const FString &FileName);
+} // namespace InteractionJournal
+
+/**
+ * Single event as stored in a journal
+ * 저널에 저장된 단일 이벤트
+ */
+struct FInteractionJournalEvent {
+  /** Seconds since the journal was opened */
+  double Timestamp = 0.0;
+
+  /** Frames since the journal was opened */
+  uint32 FrameOffset = 0;
+
+  /** Stable ids (0 = none); the target actor is the component's owner */
+  uint32 InstigatorId = 0;
+  uint32 TargetComponentId = 0;
+  uint32 TypeId = 0;
+};
+
+/**
+ * Buffered journal writer
+ * Events are encoded into an in-memory buffer on the game thread; full
+ * buffers are handed to a task pipe that owns the file handle.
+ *
+ * 버퍼링 저널 기록기
+ * 게임 스레드에서 메모리 버퍼에 인코딩하고, 가득 찬 버퍼는 파일 핸들을 가진
+ * 태스크 파이프로 넘김
+ */
+class BASICPROJECT_API FInteractionJournalWriter {
+public:
+  explicit FInteractionJournalWriter(const FString &InPath);
+
+  /** Flushes remaining events and closes the file */
+  ~FInteractionJournalWriter();
+
+  /** Append an event (game thread) */
+  void Append(const FInteractionEvent &Event);
+
+  /** Hand the current buffer to the background writer */
+  void Flush();
+
+  /** Journal file path */
+  const FString &GetPath() const { return Path; }
+
+  /** Number of events appended */
+  int32 GetNumEvents() const { return NumEvents; }
+
+private:
+  /** Get or assign a stable id, emitting an object record for new ids */
+  uint32 GetObjectId(FObjectKey ObjectKey);
+
+  /** Get or assign a type id, emitting a type record for new ids */
+  uint32 GetTypeId(FName InteractionType);
+
+  /** Buffer size that triggers a background write */
+  static constexpr int32 FlushThresholdBytes = 64 * 1024;
+
+  FString Path;
+  TArray<uint8> Buffer;
+  TMap<FObjectKey, uint32> ObjectIds;
+  TMap<FName, uint32> TypeIds;
+  double StartSeconds = 0.0;
+  uint32 StartFrame = 0;
+  int32 NumEvents = 0;
+
+  /** File handle, only accessed from pipe tasks */
+  TSharedPtr<FArchive> FileWriter;
+
+  UE::Tasks::FPipe Pipe{TEXT("InteractionJournalWriter")};
+  UE::Tasks::FTask LastTask;
+};
+
+/**
+ * Journal reader, decodes a whole journal into memory
+ * 저널 전체를 메모리로 디코딩하는 리더
+ */
+class BASICPROJECT_API FInteractionJournalReader {
+public:
+  /** Load and decode a journal file (false if missing, unsupported or
+   * damaged, e.g. ids out of sequence) */
+  bool Load(const FString &Path);
+
+  /** Object paths indexed by id (index 0 unused) */
+  TArray<FString> ObjectPaths;
+
+  /** Interaction type tag names indexed by id (index 0 unused) */
+  TArray<FName> TypeNames;
+
+  /** Events in recording order */
+  TArray<FInteractionJournalEvent> Events;
+};
+
+/**
+ * Per-stage routing cost collected while a replay is running
+ * 리플레이 중 수집되는 단계별 라우팅 비용
+ */
+struct FInteractionRouteProfile {
+  /** Cycles spent in world-level listeners (OnInteractionReceived) */
+  uint64 WorldListenerCycles = 0;
+
+  /** Cycles spent in global tracking and its listeners */
+  uint64 GlobalTrackingCycles = 0;
+};
+
+/**
+ * Feeds a decoded journal back through FInteractionRouterRegistry::Route
+ * Runs at full speed (everything in one call) or paced by the recorded
+ * timestamps, and reports routing throughput and per-stage cost.
+ *
+ * 디코딩된 저널을 FInteractionRouterRegistry::Route로 재생
+ * 최대 속도 또는 기록된 타임스탬프 간격으로 재생하고 처리량과 단계별 비용 보고
+ */
+class BASICPROJECT_API FInteractionJournalReplay {
+public:
+  FInteractionJournalReplay(FInteractionJournalReader &&InJournal,
+                            bool bInRealTime);
+
+  /**
+   * Route all events that are due
+   * @param ElapsedSeconds Time since the replay started (ignored at full speed)
+   * @return true once every event has been routed
+   */
+  bool Dispatch(double ElapsedSeconds);
+
+  /** Log throughput and per-stage cost */
+  void LogReport(int32 NumWorldListeners) const;
+
+  /** Stage costs, filled by the router while events are dispatched */
+  FInteractionRouteProfile Profile;
+
+private:
+  /** Resolve a journal object id in the current world */
+  UObject *ResolveObject(uint32 ObjectId) const;
+
+  FInteractionJournalReader Journal;
+  TArray<TWeakObjectPtr<UObject>> ResolvedObjects;
+  TArray<FInteractionTypeId> ResolvedTypeIds;
+  int32 NumUnresolvedObjects = 0;
+  bool bRealTime = false;
+  int32 NextEvent = 0;
+  uint64 RouteCycles = 0;
+  double StartSeconds = 0.0;
+};
@@ -0,0 +1,156 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "InteractionStatsStore.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace InteractionStatsStore {
+/** File identifier ("ISTA") */
+constexpr uint32 FileMagic = 0x41545349;
+
+/** Bump when the on-disk layout changes */
+constexpr int32 FileVersion = 2;
+
+/** Version 1 files have no unlocked achievements and still load */
+constexpr int32 FirstUnlocksVersion = 2;
+} // namespace InteractionStatsStore
+
+FInteractionStatsStore::FInteractionStatsStore(const FString &InFilePath)
+    : FilePath(InFilePath) {}
+
+FInteractionStatsStore::~FInteractionStatsStore() { Flush(); }
+
+void FInteractionStatsStore::LoadAsync(
+    TUniqueFunction<void(FInteractionStatsRecord &&)> OnLoaded) {
+  LastTask = Pipe.Launch(
+      TEXT("LoadInteractionStats"),
+      [this, OnLoaded = MoveTemp(OnLoaded)]() mutable {
+        FInteractionStatsRecord Loaded;
+        if (!ReadRecord(FilePath, Loaded)) {
+          Loaded = FInteractionStatsRecord();
+        }
+        PersistedRecord = Loaded;
+
+        // Hand the result back to the game thread
+        AsyncTask(ENamedThreads::GameThread,
+                  [OnLoaded = MoveTemp(OnLoaded),
+                   Loaded = MoveTemp(Loaded)]() mutable {
+                    OnLoaded(MoveTemp(Loaded));
+                  });
+      },
+      UE::Tasks::ETaskPriority::BackgroundNormal);
+}
+
+void FInteractionStatsStore::SaveDeltaAsync(FInteractionStatsRecord &&Delta) {
+  if (Delta.IsEmpty()) {
+    return;
+  }
+
+  LastTask = Pipe.Launch(
+      TEXT("SaveInteractionStats"),
+      [this, Delta = MoveTemp(Delta)]() {
+        PersistedRecord.TotalCount += Delta.TotalCount;
+        for (const TPair<FName, int32> &Pair : Delta.CountByType) {
+          PersistedRecord.CountByType.FindOrAdd(Pair.Key) += Pair.Value;
+        }
+        for (const FName AchievementId : Delta.UnlockedAchievements) {
+          PersistedRecord.UnlockedAchievements.AddUnique(AchievementId);
+        }
+        WriteRecordAtomic(FilePath, PersistedRecord);
+      },
+      UE::Tasks::ETaskPriority::BackgroundNormal);
+}
+
+void FInteractionStatsStore::Flush() {
+  if (LastTask.IsValid()) {
+    LastTask.Wait();
+  }
+}
+
+bool FInteractionStatsStore::ReadRecord(const FString &Path,
+                                        FInteractionStatsRecord &OutRecord) {
+  TArray<uint8> Bytes;
+  if (!FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent)) {
+    return false;
+  }
+
+  FMemoryReader Reader(Bytes);
+  uint32 Magic = 0;
+  int32 Version = 0;
+  Reader << Magic;
+  Reader << Version;
+  if (Magic != InteractionStatsStore::FileMagic || Version < 1 ||
+      Version > InteractionStatsStore::FileVersion) {
+    return false;
+  }
+
+  int32 NumTypes = 0;
+  Reader << OutRecord.TotalCount;
+  Reader << NumTypes;
+  if (Reader.IsError() || NumTypes < 0) {
+    return false;
+  }
+
+  for (int32 Index = 0; Index < NumTypes && !Reader.IsError(); ++Index) {
+    FString TypeName;
+    int32 Count = 0;
+    Reader << TypeName;
+    Reader << Count;
+    OutRecord.CountByType.Add(FName(*TypeName), Count);
+  }
+
+  if (Version >= InteractionStatsStore::FirstUnlocksVersion &&
+      !Reader.IsError()) {
+    int32 NumUnlocked = 0;
+    Reader << NumUnlocked;
+    if (Reader.IsError() || NumUnlocked < 0) {
+      return false;
+    }
+    for (int32 Index = 0; Index < NumUnlocked && !Reader.IsError(); ++Index) {
+      FString AchievementId;
+      Reader << AchievementId;
+      OutRecord.UnlockedAchievements.AddUnique(FName(*AchievementId));
+    }
+  }
+
+  return !Reader.IsError();
+}
+
+bool FInteractionStatsStore::WriteRecordAtomic(
+    const FString &Path, const FInteractionStatsRecord &Record) {
+  TArray<uint8> Bytes;
+  FMemoryWriter Writer(Bytes);
+
+  uint32 Magic = InteractionStatsStore::FileMagic;
+  int32 Version = InteractionStatsStore::FileVersion;
+  int32 TotalCount = Record.TotalCount;
+  int32 NumTypes = Record.CountByType.Num();
+  Writer << Magic;
+  Writer << Version;
+  Writer << TotalCount;
+  Writer << NumTypes;
+  for (const TPair<FName, int32> &Pair : Record.CountByType) {
+    FString TypeName = Pair.Key.ToString();
+    int32 Count = Pair.Value;
+    Writer << TypeName;
+    Writer << Count;
+  }
+
+  int32 NumUnlocked = Record.UnlockedAchievements.Num();
+  Writer << NumUnlocked;
+  for (const FName AchievementId : Record.UnlockedAchievements) {
+    FString AchievementName = AchievementId.ToString();
+    Writer << AchievementName;
+  }
+
+  // Never leave a half-written stats file behind
+  const FString TempPath = Path + TEXT(".tmp");
+  if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath)) {
+    return false;
+  }
+  return IFileManager::Get().Move(*Path, *TempPath, /*bReplace=*/true,
+                                  /*bEvenIfReadOnly=*/true);
+}
@@ -0,0 +1,80 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/Pipe.h"
+#include "Tasks/Task.h"
+
+/**
+ * Interaction statistics as persisted on disk (also used for deltas)
+ * 디스크에 저장되는 상호작용 통계 (델타 전달에도 사용)
+ */
+struct FInteractionStatsRecord {
+  /** Total interactions */
+  int32 TotalCount = 0;
+
+  /** Interactions by type */
+  TMap<FName, int32> CountByType;
+
+  /** Achievement ids unlocked so far (deltas: newly unlocked) */
+  TArray<FName> UnlockedAchievements;
+
+  bool IsEmpty() const {
+    return TotalCount == 0 && CountByType.IsEmpty() &&
+           UnlockedAchievements.IsEmpty();
+  }
+};
+
+/**
+ * Background persistence for interaction statistics
+ * All file I/O and serialisation run on a task pipe so requests execute in
+ * order off the game thread. The game thread only hands over deltas; the
+ * pipe merges them into its own copy of the persisted record and rewrites
+ * the file atomically (temp file + rename).
+ *
+ * 상호작용 통계 백그라운드 저장소
+ * 모든 파일 I/O와 직렬화는 태스크 파이프에서 순서대로 실행됨
+ * 게임 스레드는 델타만 전달하고, 파이프가 병합 후 임시 파일 + 이름 변경으로
+ * 원자적으로 기록함
+ */
+class FInteractionStatsStore {
+public:
+  explicit FInteractionStatsStore(const FString &InFilePath);
+
+  /** Waits for pending writes so no task outlives the store */
+  ~FInteractionStatsStore();
+
+  /**
+   * Load the persisted record on the pipe
+   * @param OnLoaded Called on the game thread with the loaded record (empty
+   * if the file is missing or invalid)
+   */
+  void LoadAsync(TUniqueFunction<void(FInteractionStatsRecord &&)> OnLoaded);
+
+  /** Merge a delta into the persisted record and write it on the pipe */
+  void SaveDeltaAsync(FInteractionStatsRecord &&Delta);
+
+  /** Block until all queued work has finished (shutdown only) */
+  void Flush();
+
+private:
+  /** Read and validate a stats file */
+  static bool ReadRecord(const FString &Path, FInteractionStatsRecord &OutRecord);
+
+  /** Serialise to a temp file and rename it over the destination */
+  static bool WriteRecordAtomic(const FString &Path,
+                                const FInteractionStatsRecord &Record);
+
+  /** Destination file path */
+  FString FilePath;
+
+  /** Serialises all store work off the game thread */
+  UE::Tasks::FPipe Pipe{TEXT("InteractionStatsStore")};
+
+  /** Last task launched on the pipe (pipe tasks complete in order) */
+  UE::Tasks::FTask LastTask;
+
+  /** Persisted record, only accessed from pipe tasks */
+  FInteractionStatsRecord PersistedRecord;
+};
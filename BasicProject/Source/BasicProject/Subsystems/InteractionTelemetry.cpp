@@ -0,0 +1,306 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "InteractionTelemetry.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/ScopeLock.h"
+
+namespace InteractionTelemetry {
+/** Current time as a whole second index */
+int64 GetCurrentSecond() {
+  return static_cast<int64>(FPlatformTime::Seconds());
+}
+
+/** Map a latency in cycles to its log2 microsecond bucket */
+int32 GetLatencyBucket(uint64 LatencyCycles) {
+  const double Micros =
+      FPlatformTime::ToSeconds64(LatencyCycles) * 1000000.0;
+  const uint32 WholeMicros =
+      static_cast<uint32>(FMath::Clamp(Micros, 1.0, double(MAX_uint32)));
+  return FMath::Min<int32>(FMath::FloorLog2(WholeMicros),
+                           FInteractionTelemetry::NumLatencyBuckets - 1);
+}
+} // namespace InteractionTelemetry
+
+FInteractionTelemetry::FInteractionTelemetry() { Reset(); }
+
+void FInteractionTelemetry::Reset() {
+  FScopeLock Lock(&SlotLock);
+
+  for (FShard &Shard : Shards) {
+    Shard.Total.store(0, std::memory_order_relaxed);
+    for (std::atomic<int64> &Count : Shard.CountByType) {
+      Count.store(0, std::memory_order_relaxed);
+    }
+    for (std::atomic<int64> &Count : Shard.CountByInstigator) {
+      Count.store(0, std::memory_order_relaxed);
+    }
+    for (std::atomic<uint32> &Count : Shard.LatencyBuckets) {
+      Count.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  for (int32 TypeSlot = 0; TypeSlot < MaxTypes; ++TypeSlot) {
+    TypeNames[TypeSlot] = NAME_None;
+    for (std::atomic<uint64> &Bucket : Window[TypeSlot]) {
+      Bucket.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  for (int32 Slot = 0; Slot < MaxInstigators; ++Slot) {
+    InstigatorKeys[Slot] = FObjectKey();
+    InstigatorNames[Slot] = NAME_None;
+  }
+
+  // Slot 0 is always the overflow bucket
+  NumTypes.store(1, std::memory_order_release);
+  NumInstigators.store(1, std::memory_order_release);
+}
+
+void FInteractionTelemetry::Record(FName InteractionType,
+                                   FObjectKey Instigator,
+                                   uint64 LatencyCycles) {
+  const int32 TypeSlot = FindOrAddTypeSlot(InteractionType);
+  const int32 InstigatorSlot = FindOrAddInstigatorSlot(Instigator);
+
+  FShard &Shard = GetLocalShard();
+  Shard.Total.fetch_add(1, std::memory_order_relaxed);
+  Shard.CountByType[TypeSlot].fetch_add(1, std::memory_order_relaxed);
+  Shard.CountByInstigator[InstigatorSlot].fetch_add(1,
+                                                    std::memory_order_relaxed);
+  Shard.LatencyBuckets[InteractionTelemetry::GetLatencyBucket(LatencyCycles)]
+      .fetch_add(1, std::memory_order_relaxed);
+
+  AddToWindow(TypeSlot, InteractionTelemetry::GetCurrentSecond());
+}
+
+int64 FInteractionTelemetry::GetTotalCount() const {
+  int64 Total = 0;
+  for (const FShard &Shard : Shards) {
+    Total += Shard.Total.load(std::memory_order_relaxed);
+  }
+  return Total;
+}
+
+int64 FInteractionTelemetry::GetCountByType(FName InteractionType) const {
+  const int32 TypeSlot = FindTypeSlot(InteractionType);
+  if (TypeSlot == INDEX_NONE) {
+    return 0;
+  }
+
+  int64 Total = 0;
+  for (const FShard &Shard : Shards) {
+    Total += Shard.CountByType[TypeSlot].load(std::memory_order_relaxed);
+  }
+  return Total;
+}
+
+int64 FInteractionTelemetry::GetCountByInstigator(
+    const UObject *Instigator) const {
+  const int32 Slot =
+      Instigator ? FindInstigatorSlot(FObjectKey(Instigator)) : INDEX_NONE;
+  if (Slot == INDEX_NONE) {
+    return 0;
+  }
+
+  int64 Total = 0;
+  for (const FShard &Shard : Shards) {
+    Total += Shard.CountByInstigator[Slot].load(std::memory_order_relaxed);
+  }
+  return Total;
+}
+
+float FInteractionTelemetry::GetEventsPerSecond(FName InteractionType,
+                                                int32 InWindowSeconds) const {
+  const int32 Seconds = FMath::Clamp(InWindowSeconds, 1, WindowSeconds);
+  const int64 Now = InteractionTelemetry::GetCurrentSecond();
+
+  // Only completed seconds are counted so the rate does not jitter
+  int64 Events = 0;
+  if (InteractionType.IsNone()) {
+    const int32 Num = NumTypes.load(std::memory_order_acquire);
+    for (int32 TypeSlot = 0; TypeSlot < Num; ++TypeSlot) {
+      Events += SumWindow(TypeSlot, Now - Seconds, Now);
+    }
+  } else {
+    const int32 TypeSlot = FindTypeSlot(InteractionType);
+    if (TypeSlot == INDEX_NONE) {
+      return 0.0f;
+    }
+    Events = SumWindow(TypeSlot, Now - Seconds, Now);
+  }
+
+  return static_cast<float>(Events) / static_cast<float>(Seconds);
+}
+
+double FInteractionTelemetry::GetLatencyPercentileMs(float Percentile) const {
+  uint64 Buckets[NumLatencyBuckets] = {};
+  uint64 Total = 0;
+  for (const FShard &Shard : Shards) {
+    for (int32 Bucket = 0; Bucket < NumLatencyBuckets; ++Bucket) {
+      const uint32 Count =
+          Shard.LatencyBuckets[Bucket].load(std::memory_order_relaxed);
+      Buckets[Bucket] += Count;
+      Total += Count;
+    }
+  }
+
+  if (Total == 0) {
+    return 0.0;
+  }
+
+  const uint64 Rank = static_cast<uint64>(
+      FMath::CeilToDouble(FMath::Clamp(Percentile, 0.0f, 1.0f) * Total));
+  uint64 Cumulative = 0;
+  for (int32 Bucket = 0; Bucket < NumLatencyBuckets; ++Bucket) {
+    Cumulative += Buckets[Bucket];
+    if (Cumulative >= FMath::Max<uint64>(Rank, 1)) {
+      // Upper bound of bucket [2^B, 2^(B+1)) microseconds
+      return static_cast<double>(1ull << (Bucket + 1)) / 1000.0;
+    }
+  }
+  return static_cast<double>(1ull << NumLatencyBuckets) / 1000.0;
+}
+
+void FInteractionTelemetry::GetTypeSnapshot(
+    TArray<FInteractionTypeTelemetry> &OutTypes,
+    int32 InWindowSeconds) const {
+  const int32 Num = NumTypes.load(std::memory_order_acquire);
+  const int32 Seconds = FMath::Clamp(InWindowSeconds, 1, WindowSeconds);
+  const int64 Now = InteractionTelemetry::GetCurrentSecond();
+
+  OutTypes.Reset(Num);
+  for (int32 TypeSlot = 0; TypeSlot < Num; ++TypeSlot) {
+    FInteractionTypeTelemetry &Entry = OutTypes.AddDefaulted_GetRef();
+    Entry.InteractionType = TypeNames[TypeSlot];
+    for (const FShard &Shard : Shards) {
+      Entry.TotalCount +=
+          Shard.CountByType[TypeSlot].load(std::memory_order_relaxed);
+    }
+    Entry.EventsPerSecond =
+        static_cast<float>(SumWindow(TypeSlot, Now - Seconds, Now)) /
+        static_cast<float>(Seconds);
+  }
+}
+
+void FInteractionTelemetry::GetInstigatorSnapshot(
+    TArray<FInstigatorTelemetry> &OutInstigators) const {
+  const int32 Num = NumInstigators.load(std::memory_order_acquire);
+
+  OutInstigators.Reset(Num);
+  for (int32 Slot = 0; Slot < Num; ++Slot) {
+    FInstigatorTelemetry &Entry = OutInstigators.AddDefaulted_GetRef();
+    Entry.InstigatorName = InstigatorNames[Slot];
+    for (const FShard &Shard : Shards) {
+      Entry.TotalCount +=
+          Shard.CountByInstigator[Slot].load(std::memory_order_relaxed);
+    }
+  }
+}
+
+int32 FInteractionTelemetry::FindOrAddTypeSlot(FName InteractionType) {
+  const int32 Existing = FindTypeSlot(InteractionType);
+  if (Existing != INDEX_NONE) {
+    return Existing;
+  }
+
+  // Slow path: only taken the first time a type is seen
+  FScopeLock Lock(&SlotLock);
+  const int32 Num = NumTypes.load(std::memory_order_relaxed);
+  for (int32 TypeSlot = 1; TypeSlot < Num; ++TypeSlot) {
+    if (TypeNames[TypeSlot] == InteractionType) {
+      return TypeSlot;
+    }
+  }
+  if (Num >= MaxTypes) {
+    return 0;
+  }
+
+  TypeNames[Num] = InteractionType;
+  NumTypes.store(Num + 1, std::memory_order_release);
+  return Num;
+}
+
+int32 FInteractionTelemetry::FindOrAddInstigatorSlot(FObjectKey Instigator) {
+  if (Instigator == FObjectKey()) {
+    return 0;
+  }
+
+  const int32 Existing = FindInstigatorSlot(Instigator);
+  if (Existing != INDEX_NONE) {
+    return Existing;
+  }
+
+  FScopeLock Lock(&SlotLock);
+  const int32 Num = NumInstigators.load(std::memory_order_relaxed);
+  for (int32 Slot = 1; Slot < Num; ++Slot) {
+    if (InstigatorKeys[Slot] == Instigator) {
+      return Slot;
+    }
+  }
+  if (Num >= MaxInstigators) {
+    return 0;
+  }
+
+  const UObject *InstigatorObject = Instigator.ResolveObjectPtr();
+  InstigatorKeys[Num] = Instigator;
+  InstigatorNames[Num] =
+      InstigatorObject ? InstigatorObject->GetFName() : NAME_None;
+  NumInstigators.store(Num + 1, std::memory_order_release);
+  return Num;
+}
+
+int32 FInteractionTelemetry::FindTypeSlot(FName InteractionType) const {
+  const int32 Num = NumTypes.load(std::memory_order_acquire);
+  for (int32 TypeSlot = 1; TypeSlot < Num; ++TypeSlot) {
+    if (TypeNames[TypeSlot] == InteractionType) {
+      return TypeSlot;
+    }
+  }
+  return INDEX_NONE;
+}
+
+int32 FInteractionTelemetry::FindInstigatorSlot(FObjectKey Instigator) const {
+  const int32 Num = NumInstigators.load(std::memory_order_acquire);
+  for (int32 Slot = 1; Slot < Num; ++Slot) {
+    if (InstigatorKeys[Slot] == Instigator) {
+      return Slot;
+    }
+  }
+  return INDEX_NONE;
+}
+
+FInteractionTelemetry::FShard &FInteractionTelemetry::GetLocalShard() {
+  return Shards[FPlatformTLS::GetCurrentThreadId() % NumShards];
+}
+
+void FInteractionTelemetry::AddToWindow(int32 TypeSlot, int64 Second) {
+  std::atomic<uint64> &Bucket = Window[TypeSlot][Second % NumWindowBuckets];
+
+  uint64 Packed = Bucket.load(std::memory_order_relaxed);
+  uint64 NewPacked;
+  do {
+    const int64 BucketSecond = static_cast<int64>(Packed >> WindowCountBits);
+    if (BucketSecond != Second) {
+      // Bucket belongs to an older second: restart it
+      NewPacked = (static_cast<uint64>(Second) << WindowCountBits) | 1;
+    } else if ((Packed & WindowCountMask) == WindowCountMask) {
+      return; // Saturated
+    } else {
+      NewPacked = Packed + 1;
+    }
+  } while (!Bucket.compare_exchange_weak(Packed, NewPacked,
+                                         std::memory_order_relaxed));
+}
+
+int64 FInteractionTelemetry::SumWindow(int32 TypeSlot, int64 FromSecond,
+                                       int64 ToSecond) const {
+  int64 Events = 0;
+  for (const std::atomic<uint64> &Bucket : Window[TypeSlot]) {
+    const uint64 Packed = Bucket.load(std::memory_order_relaxed);
+    const int64 BucketSecond = static_cast<int64>(Packed >> WindowCountBits);
+    if (BucketSecond >= FromSecond && BucketSecond < ToSecond) {
+      Events += static_cast<int64>(Packed & WindowCountMask);
+    }
+  }
+  return Events;
+}
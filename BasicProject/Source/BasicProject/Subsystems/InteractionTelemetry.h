@@ -0,0 +1,165 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/ObjectKey.h"
+#include <atomic>
+#include "InteractionTelemetry.generated.h"
+
+/**
+ * Telemetry snapshot for a single interaction type (UI / Blueprint view)
+ * 상호작용 타입별 텔레메트리 스냅샷 (UI / 블루프린트용)
+ */
+USTRUCT(BlueprintType)
+struct BASICPROJECT_API FInteractionTypeTelemetry {
+  GENERATED_BODY()
+
+  /** Interaction type (None = overflow bucket for untracked types) */
+  UPROPERTY(BlueprintReadOnly, Category = "Interaction|Telemetry")
+  FName InteractionType;
+
+  /** Interactions recorded since the telemetry was reset */
+  UPROPERTY(BlueprintReadOnly, Category = "Interaction|Telemetry")
+  int64 TotalCount = 0;
+
+  /** Average events per second over the requested sliding window */
+  UPROPERTY(BlueprintReadOnly, Category = "Interaction|Telemetry")
+  float EventsPerSecond = 0.0f;
+};
+
+/**
+ * Telemetry snapshot for a single instigator (UI / Blueprint view)
+ * 인스티게이터별 텔레메트리 스냅샷 (UI / 블루프린트용)
+ */
+USTRUCT(BlueprintType)
+struct BASICPROJECT_API FInstigatorTelemetry {
+  GENERATED_BODY()
+
+  /** Instigator name (None = overflow bucket once all slots are taken) */
+  UPROPERTY(BlueprintReadOnly, Category = "Interaction|Telemetry")
+  FName InstigatorName;
+
+  /** Interactions recorded for this instigator */
+  UPROPERTY(BlueprintReadOnly, Category = "Interaction|Telemetry")
+  int64 TotalCount = 0;
+};
+
+/**
+ * Fixed-size, lock-free interaction telemetry aggregator
+ * Recording touches only per-thread counter shards and packed atomic window
+ * buckets, so it is safe from any thread and never allocates. Queries sum the
+ * shards and are cheap enough to poll every frame.
+ *
+ * 고정 크기 락프리 상호작용 텔레메트리 집계기
+ * 기록 시 스레드별 카운터 샤드와 원자적 윈도우 버킷만 갱신 - 할당 없음
+ * 조회는 샤드 합산만 수행하므로 매 프레임 폴링 가능
+ */
+class BASICPROJECT_API FInteractionTelemetry {
+public:
+  /** Tracked interaction types (slot 0 is the overflow bucket) */
+  static constexpr int32 MaxTypes = 32;
+
+  /** Tracked instigators (slot 0 is the overflow bucket) */
+  static constexpr int32 MaxInstigators = 16;
+
+  /** Counter shards, selected by thread id */
+  static constexpr int32 NumShards = 8;
+
+  /** Length of the events-per-second sliding window in completed seconds */
+  static constexpr int32 WindowSeconds = 60;
+
+  /** One bucket per second: the full window plus the second in progress */
+  static constexpr int32 NumWindowBuckets = WindowSeconds + 1;
+
+  /** Log2 latency buckets in microseconds (1us .. ~0.5s) */
+  static constexpr int32 NumLatencyBuckets = 20;
+
+  FInteractionTelemetry();
+
+  /** Clear all counters, windows and slot assignments (game thread only) */
+  void Reset();
+
+  /**
+   * Record a single interaction
+   * @param InteractionType Interaction type identifier
+   * @param Instigator Key of the object that initiated the interaction; only
+   * resolved the first time an instigator is seen
+   * @param LatencyCycles Routing latency in FPlatformTime cycles
+   */
+  void Record(FName InteractionType, FObjectKey Instigator,
+              uint64 LatencyCycles);
+
+  /** Total interactions recorded */
+  int64 GetTotalCount() const;
+
+  /** Interactions recorded for a type (0 if the type is not tracked) */
+  int64 GetCountByType(FName InteractionType) const;
+
+  /** Interactions recorded for an instigator (0 if not tracked) */
+  int64 GetCountByInstigator(const UObject *Instigator) const;
+
+  /**
+   * Average events per second for a type over the last completed seconds
+   * @param InteractionType Type to query (None = all types)
+   * @param InWindowSeconds Window length, clamped to [1, WindowSeconds]
+   */
+  float GetEventsPerSecond(FName InteractionType, int32 InWindowSeconds) const;
+
+  /** Routing latency percentile in milliseconds (upper bound of the bucket) */
+  double GetLatencyPercentileMs(float Percentile) const;
+
+  /** Fill per-type snapshots for all tracked types (window clamped to
+   * [1, WindowSeconds]) */
+  void GetTypeSnapshot(TArray<FInteractionTypeTelemetry> &OutTypes,
+                       int32 InWindowSeconds) const;
+
+  /** Fill per-instigator snapshots for all tracked instigators */
+  void GetInstigatorSnapshot(TArray<FInstigatorTelemetry> &OutInstigators) const;
+
+private:
+  /** Per-thread counters, padded to avoid false sharing */
+  struct alignas(PLATFORM_CACHE_LINE_SIZE) FShard {
+    std::atomic<int64> Total{0};
+    std::atomic<int64> CountByType[MaxTypes] = {};
+    std::atomic<int64> CountByInstigator[MaxInstigators] = {};
+    std::atomic<uint32> LatencyBuckets[NumLatencyBuckets] = {};
+  };
+
+  /** Bits of a window bucket that hold the event count (rest = second) */
+  static constexpr uint64 WindowCountBits = 24;
+  static constexpr uint64 WindowCountMask = (1ull << WindowCountBits) - 1;
+
+  /** Resolve the type slot, registering the type if there is room */
+  int32 FindOrAddTypeSlot(FName InteractionType);
+
+  /** Resolve the instigator slot, registering it if there is room */
+  int32 FindOrAddInstigatorSlot(FObjectKey Instigator);
+
+  /** Lock-free lookups (return INDEX_NONE if not registered) */
+  int32 FindTypeSlot(FName InteractionType) const;
+  int32 FindInstigatorSlot(FObjectKey Instigator) const;
+
+  /** Shard owned by the calling thread */
+  FShard &GetLocalShard();
+
+  /** Add one event to the window bucket of a type for the given second */
+  void AddToWindow(int32 TypeSlot, int64 Second);
+
+  /** Sum a type slot's window buckets for seconds in [FromSecond, ToSecond) */
+  int64 SumWindow(int32 TypeSlot, int64 FromSecond, int64 ToSecond) const;
+
+  FShard Shards[NumShards];
+
+  /** Packed (second << WindowCountBits | count) per type per second */
+  std::atomic<uint64> Window[MaxTypes][NumWindowBuckets] = {};
+
+  /** Slot registrations (written under SlotLock, published via Num*) */
+  FName TypeNames[MaxTypes];
+  std::atomic<int32> NumTypes{1};
+  FObjectKey InstigatorKeys[MaxInstigators];
+  FName InstigatorNames[MaxInstigators];
+  std::atomic<int32> NumInstigators{1};
+  FCriticalSection SlotLock;
+};
@@ -0,0 +1,17 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+using System.IO;
+
+public class InteractionMathTests : TestModuleRules
+{
+	public InteractionMathTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PrivateDependencyModuleNames.AddRange(new string[] { "Core" });
+
+		// InteractionMath.h is header-only and Core-only; include it without
+		// pulling in the InteractionSystem module and its engine dependencies
+		PrivateIncludePaths.Add(Path.Combine(ModuleDirectory, "..", "..",
+			"Plugins", "InteractionSystem", "Source", "InteractionSystem", "Public"));
+	}
+}
@@ -0,0 +1,216 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "InteractionMath.h"
+#include "Math/RandomStream.h"
+#include "TestHarness.h"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <string>
+
+namespace InteractionMathTests {
+/** Same density as the benchmark: about one location per square meter */
+TArray<FVector> MakeLocations(int32 Num, int32 Seed) {
+  FRandomStream Random(Seed);
+  const double HalfSize = 50.0 * FMath::Sqrt(static_cast<double>(Num));
+  TArray<FVector> Locations;
+  Locations.SetNumUninitialized(Num);
+  for (FVector &Location : Locations) {
+    Location = FVector(Random.FRandRange(-HalfSize, HalfSize),
+                       Random.FRandRange(-HalfSize, HalfSize),
+                       Random.FRandRange(0.0, 200.0));
+  }
+  return Locations;
+}
+
+/** Benchmark name with its batch size (e.g. "FindNearest 1024") */
+std::string BenchmarkName(const char *Kernel, int32 Num) {
+  return std::string(Kernel) + " " + std::to_string(Num);
+}
+} // namespace InteractionMathTests
+
+TEST_CASE("InteractionMath::CullByDistance::MatchesScalarLoop",
+          "[InteractionMath]") {
+  using namespace InteractionMathTests;
+
+  const TArray<FVector> Locations = MakeLocations(4096, 1);
+  const double RadiusSq = FMath::Square(300.0);
+  TArray<int32> Indices;
+  Indices.SetNumUninitialized(Locations.Num());
+
+  for (int32 o = 0; o < 64; ++o) {
+    const FVector Origin = Locations[o * 61 % Locations.Num()];
+
+    TArray<int32> Expected;
+    for (int32 i = 0; i < Locations.Num(); ++i) {
+      if (FVector::DistSquared(Origin, Locations[i]) < RadiusSq) {
+        Expected.Add(i);
+      }
+    }
+
+    const int32 NumInside = InteractionMath::CullByDistance(
+        Locations, Origin, RadiusSq, Indices.GetData());
+    REQUIRE(NumInside == Expected.Num());
+    CHECK(TArray<int32>(Indices.GetData(), NumInside) == Expected);
+  }
+}
+
+TEST_CASE("InteractionMath::CullByDistance::ExcludesBoundary",
+          "[InteractionMath]") {
+  const TArray<FVector> Locations = {FVector(100.0, 0.0, 0.0),
+                                     FVector(99.0, 0.0, 0.0),
+                                     FVector(0.0, -100.0, 0.0)};
+  int32 Indices[3];
+  REQUIRE(InteractionMath::CullByDistance(Locations, FVector::ZeroVector,
+                                          FMath::Square(100.0), Indices) == 1);
+  CHECK(Indices[0] == 1);
+}
+
+TEST_CASE("InteractionMath::FindNearest::MatchesScalarLoop",
+          "[InteractionMath]") {
+  using namespace InteractionMathTests;
+
+  const TArray<FVector> Locations = MakeLocations(4096, 2);
+  const double MaxDistanceSq = FMath::Square(150.0);
+
+  // Every other location, so the result has to map back through Indices
+  TArray<int32> Indices;
+  for (int32 i = 0; i < Locations.Num(); i += 2) {
+    Indices.Add(i);
+  }
+
+  for (int32 o = 0; o < 64; ++o) {
+    const FVector Origin = Locations[o * 67 % Locations.Num()] + FVector(1.0);
+
+    int32 Expected = INDEX_NONE;
+    double ExpectedDistanceSq = MaxDistanceSq;
+    for (const int32 Index : Indices) {
+      const double DistanceSq = FVector::DistSquared(Origin, Locations[Index]);
+      if (DistanceSq < ExpectedDistanceSq) {
+        ExpectedDistanceSq = DistanceSq;
+        Expected = Index;
+      }
+    }
+
+    double DistanceSq = 0.0;
+    CHECK(InteractionMath::FindNearest(Locations, Indices, Origin,
+                                       MaxDistanceSq, DistanceSq) == Expected);
+    CHECK(DistanceSq == ExpectedDistanceSq);
+  }
+}
+
+TEST_CASE("InteractionMath::FindNearest::FirstEquidistantWins",
+          "[InteractionMath]") {
+  const TArray<FVector> Locations = {
+      FVector(200.0, 0.0, 0.0), FVector(0.0, 50.0, 0.0),
+      FVector(-50.0, 0.0, 0.0), FVector(0.0, 0.0, 50.0)};
+  const TArray<int32> Indices = {0, 1, 2, 3};
+
+  double DistanceSq = 0.0;
+  CHECK(InteractionMath::FindNearest(Locations, Indices, FVector::ZeroVector,
+                                     FMath::Square(100.0), DistanceSq) == 1);
+  CHECK(DistanceSq == FMath::Square(50.0));
+
+  // Nothing strictly inside: no index, distance left at the limit
+  CHECK(InteractionMath::FindNearest(Locations, Indices, FVector::ZeroVector,
+                                     FMath::Square(50.0),
+                                     DistanceSq) == INDEX_NONE);
+  CHECK(DistanceSq == FMath::Square(50.0));
+}
+
+TEST_CASE("InteractionMath::StepSpringFade::Settles", "[InteractionMath]") {
+  const InteractionMath::FSpringParams Params =
+      InteractionMath::FSpringParams::Make(0.3f, 2.0f);
+
+  float Scale = 0.0f;
+  float ScaleVelocity = 0.0f;
+  float Opacity = 0.0f;
+  bool bSettled = false;
+  int32 Steps = 0;
+  for (; Steps < 600 && !bSettled; ++Steps) {
+    bSettled = InteractionMath::StepSpringFade(Scale, ScaleVelocity, 1.0f,
+                                               Opacity, 1.0f, Params,
+                                               1.0f / 60.0f);
+    CHECK(Opacity >= 0.0f);
+    CHECK(Opacity <= 1.0f);
+  }
+
+  REQUIRE(bSettled);
+  CHECK(Steps > 1);
+  CHECK(Scale == 1.0f);
+  CHECK(Opacity == 1.0f);
+  CHECK(ScaleVelocity == 0.0f);
+}
+
+// Microbenchmarks, hidden from the default run; CI times them without the
+// editor with the [InteractionMathBenchmark] tag
+
+TEST_CASE("InteractionMath::Benchmark::CullByDistance",
+          "[.][InteractionMathBenchmark]") {
+  using namespace InteractionMathTests;
+
+  const int32 Num = GENERATE(64, 1024, 16384);
+  const TArray<FVector> Locations = MakeLocations(Num, 3);
+  const FVector Origin = Locations[Num / 2];
+  const double RadiusSq = FMath::Square(300.0);
+  TArray<int32> Indices;
+  Indices.SetNumUninitialized(Num);
+
+  BENCHMARK(BenchmarkName("CullByDistance", Num)) {
+    return InteractionMath::CullByDistance(Locations, Origin, RadiusSq,
+                                           Indices.GetData());
+  };
+}
+
+TEST_CASE("InteractionMath::Benchmark::FindNearest",
+          "[.][InteractionMathBenchmark]") {
+  using namespace InteractionMathTests;
+
+  const int32 Num = GENERATE(64, 1024, 16384);
+  const TArray<FVector> Locations = MakeLocations(Num, 4);
+  const FVector Origin = Locations[Num / 2] + FVector(1.0);
+  const double MaxDistanceSq = FMath::Square(150.0);
+  TArray<int32> Indices;
+  Indices.SetNumUninitialized(Num);
+  for (int32 i = 0; i < Num; ++i) {
+    Indices[i] = i;
+  }
+
+  BENCHMARK(BenchmarkName("FindNearest", Num)) {
+    double DistanceSq = 0.0;
+    return InteractionMath::FindNearest(Locations, Indices, Origin,
+                                        MaxDistanceSq, DistanceSq);
+  };
+}
+
+TEST_CASE("InteractionMath::Benchmark::StepSpringFade",
+          "[.][InteractionMathBenchmark]") {
+  const int32 Num = GENERATE(64, 1024, 16384);
+  const InteractionMath::FSpringParams Params =
+      InteractionMath::FSpringParams::Make(0.3f, 2.0f);
+
+  // Markers start spread over the animation; the target flips every run so
+  // they keep animating instead of taking the settled path
+  TArray<float> Scales, Velocities, Opacities;
+  Scales.SetNumUninitialized(Num);
+  Velocities.SetNumZeroed(Num);
+  Opacities.SetNumUninitialized(Num);
+  for (int32 i = 0; i < Num; ++i) {
+    Scales[i] = static_cast<float>(i % 100) / 100.0f;
+    Opacities[i] = Scales[i];
+  }
+  bool bShown = true;
+
+  BENCHMARK(InteractionMathTests::BenchmarkName("StepSpringFade", Num)) {
+    const float Target = bShown ? 1.0f : 0.0f;
+    bShown = !bShown;
+    int32 NumSettled = 0;
+    for (int32 i = 0; i < Num; ++i) {
+      NumSettled += InteractionMath::StepSpringFade(
+                        Scales[i], Velocities[i], Target, Opacities[i], Target,
+                        Params, 1.0f / 60.0f)
+                        ? 1
+                        : 0;
+    }
+    return NumSettled;
+  };
+}